@@ -1,13 +1,36 @@
 #pragma once
 
 #include "src/algebra.hpp"
+#include "src/bounds.hpp"
+#include "src/charconv.hpp"
+#include "src/compact_bounded.hpp"
 #include "src/constrained_value.hpp"
+#include "src/format.hpp"
 #include "src/functional.hpp"
+#include "src/hash.hpp"
+#include "src/index.hpp"
+#include "src/make_constant.hpp"
+#include "src/mapped_array.hpp"
+#include "src/optional.hpp"
+#include "src/packed_array.hpp"
+#include "src/pointer.hpp"
 #include "src/predicate.hpp"
 #include "src/projection.hpp"
+#include "src/quantized.hpp"
+#include "src/regex.hpp"
+#include "src/renormalize.hpp"
+#include "src/sequence.hpp"
+#include "src/simd.hpp"
+#include "src/size.hpp"
+#include "src/soa_vector.hpp"
+#include "src/sorted_vector.hpp"
+#include "src/text.hpp"
+#include "src/try_make.hpp"
+#include "src/views.hpp"
 #include "src/violation_policy.hpp"
 
 #include <concepts>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -150,6 +173,27 @@ using bounded = constrained_value<
         predicate::less_equal::bind_back<hi>>,
     decltype(violation_policy)>;
 
+/// An index that is always valid for a range with `N` elements
+/// @tparam N number of elements
+///
+/// Used with `get` to access elements of a range with a size known at compile
+/// time without a runtime bounds check. As the lower bound is zero, the
+/// invariant is checked with a single unsigned comparison.
+///
+/// ~~~{.cpp}
+/// auto lookup(const std::array<int, 256>& table, index_for<256> i) -> int
+/// {
+///   return get(table, i);
+/// }
+/// ~~~
+///
+template <
+    std::size_t N,
+    auto violation_policy = on_violation::print_and_abort{}>
+  requires (N != 0)
+using index_for =
+    bounded<std::size_t, std::size_t{}, N - 1, violation_policy>;
+
 /// A value strictly contained by lower and upper bounds
 /// @tparam T underlying type
 /// @tparam lo strict lower bound
@@ -202,4 +246,81 @@ using unit = constrained_value<
     functional::compose<projection::abs, predicate::equal_to::bind_back<1>>,
     decltype(violation_policy)>;
 
+/// A value with magnitude one within a tolerance
+/// @tparam T underlying type
+/// @tparam tol tolerance of the squared magnitude
+///
+/// Adds an invariant to a type where the squared magnitude of the value must
+/// equal one within `tol`. Unlike `unit`, no square root is computed and the
+/// invariant is robust to rounding error from arithmetic on the value.
+///
+/// `projection::norm{}(t)` must be a valid expression returning a floating
+/// point type.
+///
+/// ~~~{.cpp}
+/// auto z = unit_norm<std::complex<double>>{std::polar(1.0, 0.3)};
+/// ~~~
+///
+template <
+    typename T,
+    auto tol = constant::ulp<4>,
+    auto violation_policy = on_violation::print_and_abort{}>
+using unit_norm = constrained_value<
+    T,
+    predicate::unit_norm<tol>,
+    decltype(violation_policy)>;
+
+/// A probability vector
+/// @tparam T underlying contiguous range type, e.g. `std::vector<double>`
+/// @tparam tol tolerance of the sum of the elements
+///
+/// Adds an invariant to a range of floating point values where each element
+/// must be nonnegative and the sum of the elements must equal one within
+/// `tol`. Use `renormalize_simplex` to correct accumulated rounding error
+/// before constructing a value.
+///
+/// ~~~{.cpp}
+/// auto p = simplex<std::array<double, 3>>{std::array{0.2, 0.3, 0.5}};
+/// ~~~
+///
+template <
+    typename T,
+    auto tol = constant::ulp<4>,
+    auto violation_policy = on_violation::print_and_abort{}>
+using simplex =
+    constrained_value<T, predicate::simplex<tol>, decltype(violation_policy)>;
+
+/// A pointer that is never null
+/// @tparam T pointer type, e.g. `int*` or `std::shared_ptr<int>`
+///
+template <typename T, auto violation_policy = on_violation::print_and_abort{}>
+using not_null =
+    constrained_value<T, predicate::not_null, decltype(violation_policy)>;
+
+/// A pointer that is never null and always aligned to a boundary
+/// @tparam T pointed-to type
+/// @tparam N alignment in bytes, a power of two
+///
+/// Use `assume_aligned` to obtain a pointer that the optimizer knows to be
+/// aligned and not null.
+///
+/// ~~~{.cpp}
+/// auto scale(aligned_ptr<float, 64> data, std::size_t n, float a) -> void
+/// {
+///   auto* p = assume_aligned(data);
+///   for (auto i = std::size_t{}; i != n; ++i) {
+///     p[i] *= a;
+///   }
+/// }
+/// ~~~
+///
+template <
+    typename T,
+    std::size_t N,
+    auto violation_policy = on_violation::print_and_abort{}>
+using aligned_ptr = constrained_value<
+    T*,
+    functional::all_of<predicate::not_null, predicate::aligned<N>>,
+    decltype(violation_policy)>;
+
 }  // namespace constrained_value
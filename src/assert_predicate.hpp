@@ -3,8 +3,13 @@
 #include "src/source_location.hpp"
 #include "src/violation_policy.hpp"
 
+#if defined(CONSTRAINED_VALUE_PROFILE)
+#include "src/profile.hpp"
+#endif
+
 #include <concepts>
 #include <functional>
+#include <type_traits>
 
 namespace constrained_value {
 
@@ -15,6 +20,10 @@ namespace constrained_value {
 /// @param caller function verifying the type invariant
 /// @param source_location source location invoking caller
 ///
+/// If `CONSTRAINED_VALUE_PROFILE` is defined, checks that are not constant
+/// evaluated are recorded with `profile::record`. The define must be set for
+/// all translation units of a program or for none.
+///
 template <typename P, typename V, typename T>
   requires (std::predicate<P, T> and violation_policy<V, T, P, source_location>)
 constexpr auto assert_predicate(
@@ -27,6 +36,19 @@ constexpr auto assert_predicate(
         )                                                   //
     -> bool
 {
+#if defined(CONSTRAINED_VALUE_PROFILE)
+  if (not std::is_constant_evaluated()) {
+    const auto start = profile::timestamp();
+    const auto satisfied = static_cast<bool>(std::invoke(P{}, value));
+    profile::record(sl, satisfied, profile::timestamp() - start);
+
+    if (not satisfied) {
+      std::invoke(V{}, value, P{}, caller, sl);
+    }
+    return satisfied;
+  }
+#endif
+
   if (std::invoke(P{}, value)) {
     return true;
   }
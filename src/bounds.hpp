@@ -0,0 +1,42 @@
+#pragma once
+
+#include "src/constrained_value.hpp"
+#include "src/functional.hpp"
+#include "src/predicate.hpp"
+
+namespace constrained_value {
+
+/// Obtains the inclusive bounds of a predicate
+/// @tparam P predicate type
+///
+/// Specialized for the predicate of `bounded`. Provides static data members
+/// `lower` and `upper`. Not defined for other predicates.
+///
+/// ~~~{.cpp}
+/// using P = bounded<int, 0, 15>::predicate_type;
+/// static_assert(bounds_of<P>::upper == 15);
+/// ~~~
+///
+/// @{
+template <typename P>
+struct bounds_of;
+
+template <auto lo, auto hi>
+struct bounds_of<functional::all_of<
+    predicate::greater_equal::bind_back<lo>,
+    predicate::less_equal::bind_back<hi>>>
+{
+  static constexpr auto lower = lo;
+  static constexpr auto upper = hi;
+};
+/// @}
+
+/// Specifies that a `constrained_value` has an invariant with inclusive bounds
+///
+template <typename CV>
+concept bounded_value = is_constrained_value_v<CV> and requires {
+  bounds_of<typename CV::predicate_type>::lower;
+  bounds_of<typename CV::predicate_type>::upper;
+};
+
+}  // namespace constrained_value
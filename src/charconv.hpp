@@ -0,0 +1,157 @@
+#pragma once
+
+#include "src/constrained_value.hpp"
+#include "src/expected.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+namespace constrained_value {
+
+/// Error returned when characters cannot be converted to a constrained value
+///
+struct parse_or_violation_error
+{
+  /// Cause of a conversion failure
+  ///
+  enum class error_kind : int
+  {
+    /// The characters do not represent a value of the underlying type
+    parse,
+    /// The represented value does not satisfy the invariant
+    violation,
+  };
+
+  /// Pointer to the first character not matching the pattern of the
+  /// underlying type, or past the end of a value violating the invariant
+  ///
+  const char* ptr;
+
+  /// Error reported by parsing or `std::errc{}` on an invariant violation
+  ///
+  std::errc ec;
+
+  /// Cause of the error
+  ///
+  error_kind kind;
+
+  [[nodiscard]] friend auto
+  operator==(const parse_or_violation_error&, const parse_or_violation_error&)
+      -> bool = default;
+};
+
+/// Specifies that `std::from_chars` can convert characters to the underlying
+///     type of a `constrained_value`
+///
+template <typename CV, typename... Args>
+concept from_chars_parsable =
+    is_constrained_value_v<CV> and
+    std::default_initializable<typename CV::underlying_type> and
+    requires (
+        const char* first,
+        typename CV::underlying_type& value,
+        Args... args) {
+      { std::from_chars(first, first, value, args...) }
+        -> std::same_as<std::from_chars_result>;
+    };
+
+/// Converts characters to a constrained value
+/// @tparam CV `constrained_value` type
+/// @param first, last character range to convert
+/// @param args additional arguments forwarded to `std::from_chars`, e.g. base
+///     or `std::chars_format`
+///
+/// Parses the underlying value with `std::from_chars` and checks the invariant
+/// on the parsed value directly. Parse failures and invariant violations are
+/// returned as errors and the violation policy of `CV` is not invoked.
+///
+/// All characters in [first, last) must be consumed. Trailing characters
+/// result in an error with `ec == std::errc::invalid_argument`.
+///
+/// ~~~{.cpp}
+/// const auto x = from_chars<positive<double>>(first, last);
+/// if (not x) {
+///   return x.error();
+/// }
+/// ~~~
+///
+template <typename CV, typename... Args>
+  requires from_chars_parsable<CV, Args...>
+[[nodiscard]] auto from_chars(const char* first, const char* last, Args... args)
+    -> expected<CV, parse_or_violation_error>
+{
+  using T = typename CV::underlying_type;
+  using P = typename CV::predicate_type;
+  using kind = parse_or_violation_error::error_kind;
+  using error = unexpected<parse_or_violation_error>;
+
+  auto value = T{};
+  const auto [ptr, ec] = std::from_chars(first, last, value, args...);
+
+  if (ec != std::errc{}) {
+    return error{{ptr, ec, kind::parse}};
+  }
+  if (ptr != last) {
+    return error{{ptr, std::errc::invalid_argument, kind::parse}};
+  }
+  if (not std::invoke(P{}, std::as_const(value))) {
+    return error{{ptr, std::errc{}, kind::violation}};
+  }
+
+  return CV{unchecked, std::move(value)};
+}
+
+/// Converts delimited characters to a sequence of constrained values
+/// @tparam CV `constrained_value` type
+/// @param first, last character range to convert
+/// @param delimiter character separating each value
+/// @param out output iterator for converted values
+/// @param args additional arguments forwarded to `std::from_chars`
+/// @return output iterator past the last converted value
+///
+/// Converts each field in [first, last) separated by `delimiter` with
+/// `from_chars<CV>` and writes the result to `out`. A single trailing
+/// delimiter is permitted. Conversion stops at the first error, after
+/// writing all preceding values.
+///
+/// ~~~{.cpp}
+/// auto values = std::vector<positive<double>>{};
+/// from_chars_delimited<positive<double>>(
+///     line.begin(), line.end(), ',', std::back_inserter(values));
+/// ~~~
+///
+template <
+    typename CV,
+    std::output_iterator<CV> O,
+    typename... Args>
+  requires from_chars_parsable<CV, Args...>
+[[nodiscard]] auto from_chars_delimited(
+    const char* first,
+    const char* last,
+    char delimiter,
+    O out,
+    Args... args) -> expected<O, parse_or_violation_error>
+{
+  while (first != last) {
+    const auto* const field_last = std::find(first, last, delimiter);
+
+    auto value = from_chars<CV>(first, field_last, args...);
+    if (not value) {
+      return unexpected{value.error()};
+    }
+
+    *out = *std::move(value);
+    ++out;
+
+    first = (field_last == last) ? last : std::next(field_last);
+  }
+
+  return out;
+}
+
+}  // namespace constrained_value
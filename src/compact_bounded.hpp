@@ -0,0 +1,199 @@
+#pragma once
+
+#include "src/assert_predicate.hpp"
+#include "src/constrained_value.hpp"
+#include "src/detail/wrapping_cast.hpp"
+#include "src/functional.hpp"
+#include "src/predicate.hpp"
+#include "src/source_location.hpp"
+#include "src/violation_policy.hpp"
+
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace constrained_value {
+namespace detail {
+
+template <std::uint64_t max>
+using uint_least_t = std::conditional_t<
+    max <= std::numeric_limits<std::uint8_t>::max(),
+    std::uint8_t,
+    std::conditional_t<
+        max <= std::numeric_limits<std::uint16_t>::max(),
+        std::uint16_t,
+        std::conditional_t<
+            max <= std::numeric_limits<std::uint32_t>::max(),
+            std::uint32_t,
+            std::uint64_t>>>;
+
+}  // namespace detail
+
+/// A bounded integer stored in the smallest unsigned type able to represent
+///     its range
+/// @tparam T underlying type
+/// @tparam lo lower bound
+/// @tparam hi upper bound
+/// @tparam V invariant violation policy
+///
+/// Provides the interface of `bounded<T, lo, hi>`, reading and writing values
+/// of type `T`, while storing each value as an offset from `lo` in
+/// `storage_type`. The invariant check on construction guarantees that the
+/// offset is representable by `storage_type`.
+///
+/// ~~~{.cpp}
+/// struct pixel
+/// {
+///   compact_bounded<int, 0, 200> r;  // 1 byte
+///   compact_bounded<int, 0, 200> g;
+///   compact_bounded<int, 0, 200> b;
+/// };
+/// ~~~
+///
+template <
+    std::integral T,
+    auto lo,
+    auto hi,
+    auto violation_policy = on_violation::print_and_abort{}>
+  requires (
+      std::integral<decltype(lo)> and std::integral<decltype(hi)> and
+      predicate::less_equal{}(lo, hi) and
+      ::constrained_value::violation_policy<
+          decltype(violation_policy),
+          T,
+          functional::all_of<
+              predicate::greater_equal::bind_back<lo>,
+              predicate::less_equal::bind_back<hi>>,
+          source_location>)
+class compact_bounded
+{
+public:
+  /// Underlying type
+  ///
+  using underlying_type = T;
+
+  /// Predicate type
+  ///
+  using predicate_type = functional::all_of<
+      predicate::greater_equal::bind_back<lo>,
+      predicate::less_equal::bind_back<hi>>;
+
+  /// Violation policy type
+  ///
+  using violation_policy_type = decltype(violation_policy);
+
+  /// Type used to store the offset of a value from the lower bound
+  ///
+  using storage_type = detail::uint_least_t<
+      detail::wrapping_cast<std::uint64_t>(hi) -
+      detail::wrapping_cast<std::uint64_t>(lo)>;
+
+private:
+  using P = predicate_type;
+  using V = violation_policy_type;
+
+  storage_type code_;
+
+  static constexpr auto encode(T value) noexcept -> storage_type
+  {
+    return detail::wrapping_cast<storage_type>(
+        detail::wrapping_cast<std::uint64_t>(value) -
+        detail::wrapping_cast<std::uint64_t>(lo));
+  }
+
+public:
+  /// Default construct a compact_bounded
+  /// @pre `T{}` satisfies the bounds
+  ///
+  constexpr compact_bounded(source_location sl = source_location::current())
+      : code_{(assert_predicate<P, V>(T{}, __PRETTY_FUNCTION__, sl),
+               encode(T{}))}
+  {}
+
+  /// Construct a compact_bounded
+  /// @tparam U underlying type `T`
+  /// @param value `value` of underlying type
+  /// @pre value satisfies the bounds
+  ///
+  template <std::same_as<T> U>
+  constexpr compact_bounded(
+      U value, source_location sl = source_location::current())
+      : code_{(assert_predicate<P, V>(value, __PRETTY_FUNCTION__, sl),
+               encode(value))}
+  {}
+
+  /// Construct a compact_bounded without checking the invariant
+  /// @tparam U underlying type `T`
+  /// @param value `value` of underlying type
+  /// @pre value satisfies the bounds
+  ///
+  template <std::same_as<T> U>
+  constexpr compact_bounded(unchecked_t, U value) noexcept
+      : code_{encode(value)}
+  {
+    assert(std::invoke(P{}, value));
+  }
+
+  /// Return the underlying value
+  ///
+  /// Unlike `bounded<T, lo, hi>::value()`, which returns `const T&`, the
+  /// value is returned by value. Only the offset from `lo` is stored, so
+  /// there is no object of type `T` to refer to; `T` is an integral type and
+  /// is cheap to copy.
+  ///
+  [[nodiscard]] constexpr auto value() const noexcept -> T
+  {
+    return detail::wrapping_cast<T>(
+        detail::wrapping_cast<std::uint64_t>(code_) +
+        detail::wrapping_cast<std::uint64_t>(lo));
+  }
+
+  /// Implicit conversion to the underlying type
+  ///
+  [[nodiscard]] constexpr operator T() const noexcept { return value(); }
+
+  /// Comparison operators
+  ///
+  /// Offsets from the lower bound preserve the order of values, so two
+  /// `compact_bounded` values are compared without decoding.
+  ///
+  /// @{
+  [[nodiscard]] friend constexpr auto
+  operator==(const compact_bounded&, const compact_bounded&) noexcept
+      -> bool = default;
+
+  [[nodiscard]] friend constexpr auto
+  operator<=>(const compact_bounded& x, const compact_bounded& y) noexcept
+  {
+    return x.code_ <=> y.code_;
+  }
+
+  template <typename U>
+    requires (
+        not std::same_as<U, compact_bounded> and
+        std::convertible_to<const U&, T>)
+  [[nodiscard]] friend constexpr auto
+  operator==(const compact_bounded& x, const U& y) noexcept(
+      noexcept(x.value() == y)) -> bool
+  {
+    return x.value() == y;
+  }
+
+  template <typename U>
+    requires (
+        not std::same_as<U, compact_bounded> and
+        std::convertible_to<const U&, T>)
+  [[nodiscard]] friend constexpr auto
+  operator<=>(const compact_bounded& x, const U& y) noexcept(
+      noexcept(x.value() <=> y))
+  {
+    return x.value() <=> y;
+  }
+  /// @}
+};
+
+}  // namespace constrained_value
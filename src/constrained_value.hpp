@@ -1,15 +1,53 @@
 #pragma once
 
 #include "src/assert_predicate.hpp"
+#include "src/compare.hpp"
 #include "src/ulp_distance.hpp"
 #include "src/violation_policy.hpp"
 
+#include <cassert>
+#include <compare>
 #include <concepts>
+#include <functional>
 #include <type_traits>
 #include <utility>
 
 namespace constrained_value {
 
+/// Tag type used to construct a `constrained_value` from a value already known
+///     to satisfy the invariant
+///
+struct unchecked_t
+{
+  explicit unchecked_t() = default;
+};
+
+/// Tag used to construct a `constrained_value` without checking the invariant
+///
+/// ~~~{.cpp}
+/// if (predicate::positive{}(x)) {
+///   return positive<double>{unchecked, x};
+/// }
+/// ~~~
+///
+inline constexpr auto unchecked = unchecked_t{};
+
+template <
+    std::copyable T,
+    std::predicate<T> P,
+    violation_policy<T, P, source_location> V>
+  requires (
+      std::same_as<T, std::remove_cvref_t<T>> and std::default_initializable<P>)
+class constrained_value;
+
+/// Checks if a type is a specialization of `constrained_value`
+/// @{
+template <typename...>
+inline constexpr auto is_constrained_value_v = false;
+template <typename... Ts>
+inline constexpr auto is_constrained_value_v<constrained_value<Ts...>> = true;
+/// @}
+
 /// A value that always satisfies an invariant
 /// @tparam T underlying type
 /// @tparam P predicates describing a type invariant
@@ -86,6 +124,23 @@ public:
       : value_{(assert_predicate<P, V>(value, __PRETTY_FUNCTION__, sl), value)}
   {}
 
+  /// Construct a constrained_value without checking the invariant
+  /// @tparam U underlying type `T`
+  /// @param value `value` of underlying type
+  /// @pre value satisfies `P`
+  ///
+  /// Used when `value` has already been validated, e.g. by a batch check, to
+  /// avoid evaluating `P` a second time. The precondition is only verified with
+  /// `assert`.
+  ///
+  template <std::same_as<T> U>
+  constexpr constrained_value(unchecked_t, U value) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : value_{std::move(value)}
+  {
+    assert(std::invoke(P{}, value_));
+  }
+
   /// Return a reference to the underlying value
   /// @{
   [[nodiscard]] constexpr auto value() & noexcept -> const T& { return value_; }
@@ -117,14 +172,69 @@ public:
     return value_;
   }
   /// @}
+
+  /// Comparison operators
+  ///
+  /// Underlying values are compared by reference instead of through the
+  /// implicit conversion to `T`, which would copy each operand.
+  ///
+  /// @{
+  template <typename Q, typename W>
+    requires std::equality_comparable<T>
+  [[nodiscard]] friend constexpr auto operator==(
+      const constrained_value& x,
+      const constrained_value<T, Q, W>& y) noexcept(noexcept(x.value_ ==
+                                                             y.value()))
+      -> bool
+  {
+    return x.value_ == y.value();
+  }
+
+  template <typename Q, typename W>
+    requires std::three_way_comparable<T>
+  [[nodiscard]] friend constexpr auto operator<=>(
+      const constrained_value& x,
+      const constrained_value<T, Q, W>& y) noexcept(noexcept(x.value_ <=>
+                                                             y.value()))
+  {
+    return x.value_ <=> y.value();
+  }
+
+  template <typename U>
+    requires (
+        not is_constrained_value_v<U> and std::convertible_to<const U&, T> and
+        std::equality_comparable<T>)
+  [[nodiscard]] friend constexpr auto
+  operator==(const constrained_value& x, const U& y) noexcept(
+      noexcept(x.value_ == y)) -> bool
+  {
+    return x.value_ == y;
+  }
+
+  template <typename U>
+    requires (
+        not is_constrained_value_v<U> and std::convertible_to<const U&, T> and
+        std::three_way_comparable<T>)
+  [[nodiscard]] friend constexpr auto
+  operator<=>(const constrained_value& x, const U& y) noexcept(
+      noexcept(x.value_ <=> y))
+  {
+    return x.value_ <=> y;
+  }
+  /// @}
 };
 
-/// Checks if a type is a specialization of `constrained_value`
-/// @{
-template <typename...>
-inline constexpr auto is_constrained_value_v = false;
-template <typename... Ts>
-inline constexpr auto is_constrained_value_v<constrained_value<Ts...>> = true;
-/// @}
+/// Specifies that a `constrained_value` has the same object representation as
+///     its underlying type
+///
+/// A contiguous sequence of underlying values may be viewed as a sequence of
+/// `constrained_value`s once each value is known to satisfy the invariant.
+///
+template <typename CV>
+concept layout_compatible_with_underlying =
+    is_constrained_value_v<CV> and std::is_standard_layout_v<CV> and
+    std::is_trivially_copyable_v<CV> and
+    (sizeof(CV) == sizeof(typename CV::underlying_type)) and
+    (alignof(CV) == alignof(typename CV::underlying_type));
 
 }  // namespace constrained_value
@@ -0,0 +1,20 @@
+#pragma once
+
+namespace constrained_value::detail {
+
+// Informs the optimizer that `condition` is true. The behavior is undefined
+// if `condition` is false.
+constexpr auto assume(bool condition) noexcept -> void
+{
+#if defined(__clang__)
+  __builtin_assume(condition);
+#elif defined(__GNUC__)
+  if (not condition) {
+    __builtin_unreachable();
+  }
+#else
+  static_cast<void>(condition);
+#endif
+}
+
+}  // namespace constrained_value::detail
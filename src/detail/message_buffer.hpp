@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace constrained_value::detail {
+
+// Specifies an arithmetic type that is written as a number by both
+// `std::to_chars` and a stream insertion operator. Character types are
+// excluded as they are streamed as characters.
+template <typename T>
+concept chars_formattable =
+    std::floating_point<T> or
+    (std::integral<T> and not std::same_as<T, bool> and
+     not std::same_as<T, char> and not std::same_as<T, signed char> and
+     not std::same_as<T, unsigned char> and not std::same_as<T, wchar_t> and
+     not std::same_as<T, char8_t> and not std::same_as<T, char16_t> and
+     not std::same_as<T, char32_t>);
+
+// Fixed-capacity character buffer used to format a message without heap
+// allocation, iostream state, or locale handling. Text that does not fit is
+// truncated.
+//
+// Floating-point values are written as with `%g`, the default format of a
+// stream, so that messages match those written to a stream.
+template <std::size_t N>
+class message_buffer
+{
+  std::array<char, N> data_{};
+  std::size_t size_{};
+
+public:
+  auto append(std::string_view str) noexcept -> message_buffer&
+  {
+    const auto n = std::min(str.size(), N - size_);
+    str.copy(data_.data() + size_, n);
+    size_ += n;
+    return *this;
+  }
+
+  template <chars_formattable T>
+  auto append(T value) noexcept -> message_buffer&
+  {
+    constexpr auto precision = 6;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto* const first = data_.data() + size_;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto* const last = data_.data() + N;
+
+    auto result = std::to_chars_result{};
+    if constexpr (std::floating_point<T>) {
+      result = std::to_chars(
+          first, last, value, std::chars_format::general, precision);
+    } else {
+      result = std::to_chars(first, last, value);
+    }
+
+    if (result.ec == std::errc{}) {
+      size_ += static_cast<std::size_t>(result.ptr - first);
+    }
+    return *this;
+  }
+
+  [[nodiscard]] auto view() const noexcept -> std::string_view
+  {
+    return {data_.data(), size_};
+  }
+};
+
+}  // namespace constrained_value::detail
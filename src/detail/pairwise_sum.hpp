@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace constrained_value::detail {
+
+// Sums values with pairwise summation, with an error bound that grows with
+// the logarithm of the number of values instead of linearly. Also sets
+// `invalid` to a nonzero value if any value is negative or NaN.
+//
+// Ranges of at most `block_size` values are summed with independent partial
+// sums that may be evaluated on SIMD lanes. Longer ranges are split in half,
+// on a multiple of the number of partial sums.
+template <std::floating_point T>
+constexpr auto pairwise_sum(  // NOLINT(misc-no-recursion)
+    std::span<const T> values,
+    unsigned& invalid) noexcept -> T
+{
+  constexpr auto lanes = std::size_t{8};
+  constexpr auto block_size = std::size_t{16} * lanes;
+
+  if (values.size() > block_size) {
+    const auto half = (values.size() / 2) / lanes * lanes;
+    // NOLINTNEXTLINE(misc-no-recursion)
+    return pairwise_sum(values.first(half), invalid) +
+           pairwise_sum(values.subspan(half), invalid);
+  }
+
+  auto partial = std::array<T, lanes>{};
+
+  auto i = std::size_t{};
+  for (; i + lanes <= values.size(); i += lanes) {
+    for (auto k = std::size_t{}; k != lanes; ++k) {
+      const auto x = values[i + k];
+      invalid |= static_cast<unsigned>(not (x >= T{}));
+      partial[k] += x;
+    }
+  }
+  for (auto k = std::size_t{}; i != values.size(); ++i, ++k) {
+    const auto x = values[i];
+    invalid |= static_cast<unsigned>(not (x >= T{}));
+    partial[k] += x;
+  }
+
+  for (auto width = lanes / 2; width != 0; width /= 2) {
+    for (auto k = std::size_t{}; k != width; ++k) {
+      partial[k] += partial[k + width];
+    }
+  }
+  return partial[0];
+}
+
+}  // namespace constrained_value::detail
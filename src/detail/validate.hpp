@@ -0,0 +1,58 @@
+#pragma once
+
+#include "src/assert_predicate.hpp"
+#include "src/simd.hpp"
+#include "src/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+
+namespace constrained_value::detail {
+
+// Checks that each value in [first, first + n) satisfies `P`. Returns `false`
+// if any value does not satisfy `P` and the violation policy returns.
+//
+// Each block is checked with `all_satisfy`, evaluating the predicate on SIMD
+// lanes if possible. Violations are reported with a second pass over the
+// offending block only.
+template <typename P, typename V, typename T>
+auto validate_each(
+    const T* first,
+    std::size_t n,
+    const char* caller,
+    const source_location& sl) -> bool
+{
+  static constexpr auto values_per_cache_line =
+      std::max(std::size_t{64} / sizeof(T), std::size_t{1});
+  static constexpr auto block_size =
+      std::max(std::size_t{4096} / sizeof(T), std::size_t{1});
+  static constexpr auto prefetch_distance = std::size_t{8} * block_size;
+
+  auto valid = true;
+
+  for (auto i = std::size_t{}; i < n; i += block_size) {
+    const auto last = std::min(i + block_size, n);
+
+    if (i + prefetch_distance < n) {
+      for (auto j = i + prefetch_distance;
+           j < std::min(last + prefetch_distance, n);
+           j += values_per_cache_line) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        __builtin_prefetch(first + j);
+      }
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (not all_satisfy<P>(std::span{first + i, first + last})) [[unlikely]] {
+      for (auto j = i; j != last; ++j) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        valid = assert_predicate<P, V>(first[j], caller, sl) and valid;
+      }
+    }
+  }
+
+  return valid;
+}
+
+}  // namespace constrained_value::detail
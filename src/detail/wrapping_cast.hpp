@@ -0,0 +1,18 @@
+#pragma once
+
+#include <concepts>
+
+namespace constrained_value::detail {
+
+// Converts between integral types with modular arithmetic
+template <std::integral To, std::integral From>
+constexpr auto wrapping_cast(From value) noexcept -> To
+{
+  if constexpr (std::same_as<To, From>) {
+    return value;
+  } else {
+    return static_cast<To>(value);
+  }
+}
+
+}  // namespace constrained_value::detail
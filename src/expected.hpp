@@ -0,0 +1,138 @@
+#pragma once
+
+#if __has_include(<expected>)
+#include <expected>
+#endif
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace constrained_value {
+
+#if defined(__cpp_lib_expected)
+using std::expected;
+using std::unexpected;
+#else
+/// Minimal replacement for `std::unexpected`
+///
+template <typename E>
+class unexpected
+{
+  E error_;
+
+public:
+  constexpr explicit unexpected(E error) noexcept(
+      std::is_nothrow_move_constructible_v<E>)
+      : error_{std::move(error)}
+  {}
+
+  [[nodiscard]] constexpr auto error() const& noexcept -> const E&
+  {
+    return error_;
+  }
+  [[nodiscard]] constexpr auto error() && noexcept -> E&&
+  {
+    return std::move(error_);
+  }
+};
+
+namespace detail {
+
+template <typename T>
+inline constexpr auto is_unexpected_v = false;
+
+template <typename E>
+inline constexpr auto is_unexpected_v<unexpected<E>> = true;
+
+}  // namespace detail
+
+/// Minimal replacement for `std::expected`
+///
+/// Provides the subset of the `std::expected` interface used by this library.
+///
+template <typename T, typename E>
+class expected
+{
+  std::variant<T, unexpected<E>> storage_;
+
+public:
+  using value_type = T;
+  using error_type = E;
+  using unexpected_type = unexpected<E>;
+
+  template <typename U = T>
+    requires (
+        std::constructible_from<T, U&&> and
+        not std::same_as<std::remove_cvref_t<U>, expected> and
+        not detail::is_unexpected_v<std::remove_cvref_t<U>>)
+  constexpr expected(U&& value) noexcept(
+      std::is_nothrow_constructible_v<T, U&&>)
+      : storage_{std::in_place_index<0>, std::forward<U>(value)}
+  {}
+
+  template <typename G>
+    requires std::constructible_from<E, const G&>
+  constexpr expected(const unexpected<G>& error) noexcept(
+      std::is_nothrow_constructible_v<E, const G&> and
+      std::is_nothrow_move_constructible_v<E>)
+      : storage_{std::in_place_index<1>, E{error.error()}}
+  {}
+
+  template <typename G>
+    requires std::constructible_from<E, G&&>
+  constexpr expected(unexpected<G>&& error) noexcept(
+      std::is_nothrow_constructible_v<E, G&&> and
+      std::is_nothrow_move_constructible_v<E>)
+      : storage_{std::in_place_index<1>, E{std::move(error).error()}}
+  {}
+
+  [[nodiscard]] constexpr auto has_value() const noexcept -> bool
+  {
+    return storage_.index() == 0;
+  }
+  [[nodiscard]] constexpr explicit operator bool() const noexcept
+  {
+    return has_value();
+  }
+
+  [[nodiscard]] constexpr auto value() const& -> const T&
+  {
+    return std::get<0>(storage_);
+  }
+  [[nodiscard]] constexpr auto value() && -> T&&
+  {
+    return std::get<0>(std::move(storage_));
+  }
+
+  [[nodiscard]] constexpr auto operator*() const& -> const T&
+  {
+    return value();
+  }
+  [[nodiscard]] constexpr auto operator*() && -> T&&
+  {
+    return std::move(*this).value();
+  }
+  [[nodiscard]] constexpr auto operator->() const -> const T*
+  {
+    return &value();
+  }
+
+  [[nodiscard]] constexpr auto error() const& -> const E&
+  {
+    return std::get<1>(storage_).error();
+  }
+
+  template <typename U>
+  [[nodiscard]] constexpr auto value_or(U&& default_value) const& -> T
+  {
+    if (has_value()) {
+      return **this;
+    }
+    return std::forward<U>(default_value);
+  }
+};
+#endif
+
+}  // namespace constrained_value
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace constrained_value {
+
+/// A string usable as a non-type template parameter
+/// @tparam N size of the string including the terminating null character
+///
+/// ~~~{.cpp}
+/// template <fixed_string name>
+/// struct tag {};
+///
+/// using identifier_tag = tag<"identifier">;
+/// ~~~
+///
+template <std::size_t N>
+  requires (N != 0)
+struct fixed_string
+{
+  std::array<char, N> data{};
+
+  /// Constructs a fixed string from a string literal
+  ///
+  consteval fixed_string(const char (&str)[N]) noexcept
+  {
+    std::copy_n(str, N, data.begin());
+  }
+
+  /// Returns the number of characters, excluding the terminating null
+  ///     character
+  ///
+  [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+  {
+    return N - 1;
+  }
+
+  /// Returns a view of the characters, excluding the terminating null
+  ///     character
+  ///
+  [[nodiscard]] constexpr auto view() const noexcept -> std::string_view
+  {
+    return {data.data(), N - 1};
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator==(const fixed_string&, const fixed_string&) -> bool = default;
+};
+
+}  // namespace constrained_value
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "src/constrained_value.hpp"
+#include "src/violation_info.hpp"
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#if defined(__cpp_lib_format)
+/// Formats a `constrained_value` as its underlying value
+///
+/// The format specification is forwarded to the formatter of the underlying
+/// type.
+///
+/// ~~~{.cpp}
+/// std::format("{:.3f}", positive<double>{0.5}); // "0.500"
+/// ~~~
+///
+/// @note Only available if the standard library provides `std::format`. The
+///     toolchains used in CI do not, so this specialization is not built or
+///     tested there and is not supported.
+///
+template <typename T, typename P, typename V, typename CharT>
+  requires ::constrained_value::detail::formattable<T, CharT>
+struct std::formatter<::constrained_value::constrained_value<T, P, V>, CharT>
+{
+  // `mutable` as `std::formatter<T>::format` is not `const` qualified in all
+  // standard library implementations
+  mutable std::formatter<T, CharT> value_formatter;
+
+  constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
+  {
+    return value_formatter.parse(ctx);
+  }
+
+  template <typename FormatContext>
+  auto format(
+      const ::constrained_value::constrained_value<T, P, V>& value,
+      FormatContext& ctx) const
+  {
+    return value_formatter.format(value.value(), ctx);
+  }
+};
+#endif
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "src/functional/memoize.hpp"
+
 #include <concepts>
 #include <utility>
 
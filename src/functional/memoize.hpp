@@ -0,0 +1,195 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace constrained_value::functional {
+namespace detail {
+
+// Copy of a viewed string stored in a fixed-size inline buffer, so that
+// caching a view neither refers to a buffer that may be modified or destroyed
+// nor allocates. Views longer than `N` characters are not cached.
+template <typename CharT, typename Traits, std::size_t N>
+class inline_string_key
+{
+  using view_type = std::basic_string_view<CharT, Traits>;
+
+  std::array<CharT, N> data_{};
+  std::size_t size_{};
+
+public:
+  [[nodiscard]] static constexpr auto fits(view_type str) noexcept -> bool
+  {
+    return str.size() <= N;
+  }
+
+  // @pre fits(str)
+  constexpr auto assign(view_type str) noexcept -> void
+  {
+    size_ = str.copy(data_.data(), N);
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator==(const inline_string_key& key, view_type str) noexcept -> bool
+  {
+    return view_type{key.data_.data(), key.size_} == str;
+  }
+};
+
+// Type used to store a copy of a memoized argument
+template <typename T>
+struct memo_key
+{
+  using type = T;
+};
+
+template <typename CharT, typename Traits>
+struct memo_key<std::basic_string_view<CharT, Traits>>
+{
+  static constexpr auto max_size = std::size_t{32};
+
+  using type = inline_string_key<CharT, Traits, max_size>;
+};
+
+template <typename T>
+using memo_key_t = typename memo_key<std::remove_cvref_t<T>>::type;
+
+// Checks if a key can store a copy of `value`
+template <typename Key, typename T>
+[[nodiscard]] constexpr auto fits(const T& value) noexcept -> bool
+{
+  if constexpr (requires { Key::fits(value); }) {
+    return Key::fits(value);
+  } else {
+    return true;
+  }
+}
+
+// Stores a copy of `value` in `key`
+template <typename Key, typename T>
+constexpr auto assign(Key& key, const T& value) -> void
+{
+  if constexpr (requires { key.assign(value); }) {
+    key.assign(value);
+  } else {
+    key = value;
+  }
+}
+
+template <typename T>
+concept memoizable_argument =
+    std::copyable<memo_key_t<T>> and
+    std::default_initializable<memo_key_t<T>> and
+    requires (memo_key_t<T>& key, const T& value) {
+      detail::assign(key, value);
+      { std::as_const(key) == value } -> std::convertible_to<bool>;
+    } and
+    requires (const T& value) {
+      {
+        std::hash<std::remove_cvref_t<T>>{}(value)
+      } -> std::convertible_to<std::size_t>;
+    };
+
+// Direct-mapped cache of predicate results. Each tag stores the high bits of
+// the hash of the key in slot, an occupied bit, and the cached result.
+template <typename Key, std::size_t Capacity>
+class memo_table
+{
+  static constexpr auto result_bit = std::size_t{1};
+  static constexpr auto occupied_bit = std::size_t{2};
+  static constexpr auto hash_mask = ~(result_bit | occupied_bit);
+
+  std::array<std::size_t, Capacity> tags_{};
+  std::array<Key, Capacity> keys_{};
+
+  [[nodiscard]] static constexpr auto tag(std::size_t hash) noexcept
+      -> std::size_t
+  {
+    return (hash & hash_mask) | occupied_bit;
+  }
+
+public:
+  template <typename T, typename F>
+  [[nodiscard]] auto lookup_or_invoke(const T& value, std::size_t hash, F f)
+      -> bool
+  {
+    const auto i = hash & (Capacity - 1);
+
+    if ((tags_[i] & ~result_bit) == tag(hash) and keys_[i] == value) {
+      return (tags_[i] & result_bit) != 0;
+    }
+
+    const auto result = static_cast<bool>(f(value));
+    if (not fits<Key>(value)) {
+      return result;
+    }
+
+    assign(keys_[i], value);
+    tags_[i] = tag(hash) | (result ? result_bit : std::size_t{});
+    return result;
+  }
+};
+
+}  // namespace detail
+
+/// Predicate adaptor that caches results of an expensive predicate
+/// @tparam P predicate
+/// @tparam Capacity number of cached results, a power of two
+///
+/// Results are cached in a thread-local, direct-mapped table indexed by the
+/// `std::hash` of the argument. A lookup computes one hash and, on a tag
+/// match, one equality comparison. A result evaluated for an argument that
+/// maps to an occupied slot replaces the cached result.
+///
+/// The table stores a copy of each cached argument. A `std::basic_string_view`
+/// is copied to a fixed-size inline buffer, so a miss does not allocate;
+/// views longer than 32 characters are evaluated without being cached. Other
+/// arguments are copied as is, so a miss allocates, and may throw, if copying
+/// the argument type does, as for `std::string`. Each thread holds a table of
+/// `Capacity` keys for each argument type.
+///
+/// `P` must be a pure function of its argument. During constant evaluation,
+/// `P` is invoked directly.
+///
+/// ~~~{.cpp}
+/// using identifier = constrained_value<
+///     std::string_view,
+///     functional::memoize<is_identifier>>;
+/// ~~~
+///
+template <std::default_initializable P, std::size_t Capacity = 256>
+  requires (std::has_single_bit(Capacity))
+class memoize
+{
+  template <typename T>
+  [[nodiscard]] static auto table()
+      -> detail::memo_table<detail::memo_key_t<T>, Capacity>&
+  {
+    thread_local auto t =
+        detail::memo_table<detail::memo_key_t<T>, Capacity>{};
+    return t;
+  }
+
+public:
+  template <typename T>
+    requires (
+        std::predicate<const P&, const T&> and
+        detail::memoizable_argument<T>)
+  [[nodiscard]] constexpr auto operator()(const T& value) const -> bool
+  {
+    if (std::is_constant_evaluated()) {
+      return std::invoke(P{}, value);
+    }
+
+    return table<std::remove_cvref_t<T>>().lookup_or_invoke(
+        value, std::hash<std::remove_cvref_t<T>>{}(value), P{});
+  }
+};
+
+}  // namespace constrained_value::functional
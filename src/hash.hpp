@@ -0,0 +1,102 @@
+#pragma once
+
+#include "src/constrained_value.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace constrained_value {
+namespace detail {
+
+// clang-format off
+template <typename T>
+concept hashable =
+  std::default_initializable<std::hash<T>> and
+  requires (const T& value) {
+    { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+  };
+// clang-format on
+
+template <typename T>
+[[nodiscard]] constexpr auto unwrap(const T& value) noexcept -> const auto&
+{
+  if constexpr (is_constrained_value_v<T>) {
+    return value.value();
+  } else {
+    return value;
+  }
+}
+
+}  // namespace detail
+
+/// Transparent hash function object for constrained values
+///
+/// Hashes a `constrained_value` as its underlying value, allowing lookup in an
+/// unordered associative container by the underlying type without
+/// constructing a `constrained_value`. Values convertible to
+/// `std::string_view` are hashed as `std::string_view`, which produces the
+/// same hash as `std::string`.
+///
+/// ~~~{.cpp}
+/// using key = constrained_value<std::string, P>;
+/// auto m = std::unordered_map<
+///     key, int, transparent_hash, transparent_equal_to>{};
+/// m.find(std::string_view{"name"});
+/// ~~~
+///
+struct transparent_hash
+{
+  using is_transparent = void;
+
+  template <typename T>
+    requires (
+        is_constrained_value_v<T> or
+        std::convertible_to<const T&, std::string_view> or detail::hashable<T>)
+  [[nodiscard]] constexpr auto operator()(const T& value) const -> std::size_t
+  {
+    if constexpr (is_constrained_value_v<T>) {
+      return (*this)(value.value());
+    } else if constexpr (std::convertible_to<const T&, std::string_view>) {
+      return std::hash<std::string_view>{}(value);
+    } else {
+      return std::hash<T>{}(value);
+    }
+  }
+};
+
+/// Transparent equality function object for constrained values
+///
+/// Compares constrained values and underlying values by reference.
+///
+struct transparent_equal_to
+{
+  using is_transparent = void;
+
+  template <typename T, typename U>
+    requires std::equality_comparable_with<
+        decltype(detail::unwrap(std::declval<const T&>())),
+        decltype(detail::unwrap(std::declval<const U&>()))>
+  [[nodiscard]] constexpr auto operator()(const T& x, const U& y) const
+      noexcept(noexcept(detail::unwrap(x) == detail::unwrap(y))) -> bool
+  {
+    return detail::unwrap(x) == detail::unwrap(y);
+  }
+};
+
+}  // namespace constrained_value
+
+/// Hashes a `constrained_value` as its underlying value
+///
+template <typename T, typename P, typename V>
+  requires ::constrained_value::detail::hashable<T>
+struct std::hash<::constrained_value::constrained_value<T, P, V>>
+{
+  [[nodiscard]] auto
+  operator()(const ::constrained_value::constrained_value<T, P, V>& value) const
+      noexcept(noexcept(std::hash<T>{}(value.value()))) -> std::size_t
+  {
+    return std::hash<T>{}(value.value());
+  }
+};
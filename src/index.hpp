@@ -0,0 +1,75 @@
+#pragma once
+
+#include "src/bounds.hpp"
+#include "src/constrained_value.hpp"
+#include "src/detail/wrapping_cast.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace constrained_value {
+
+/// Obtains the number of elements of a range type with a size known at
+///     compile time
+/// @tparam R range type
+///
+/// Equal to `N` for `T[N]`, `std::array<T, N>`, and `std::span<T, N>`.
+/// Equal to `std::dynamic_extent` for other types.
+///
+/// @{
+template <typename R>
+inline constexpr auto static_extent_v = std::dynamic_extent;
+
+template <typename T, std::size_t N>
+inline constexpr auto static_extent_v<T[N]> = N;
+
+template <typename T, std::size_t N>
+inline constexpr auto static_extent_v<std::array<T, N>> = N;
+
+template <typename T, std::size_t N>
+inline constexpr auto static_extent_v<std::span<T, N>> = N;
+/// @}
+
+/// Specifies that a `constrained_value` is always a valid index of a range
+///     type with a size known at compile time
+///
+template <typename I, typename R>
+concept index_of =
+    bounded_value<I> and std::integral<typename I::underlying_type> and
+    (static_extent_v<std::remove_cv_t<R>> != std::dynamic_extent) and
+    (std::cmp_greater_equal(
+        bounds_of<typename I::predicate_type>::lower, 0)) and
+    (std::cmp_less(
+        bounds_of<typename I::predicate_type>::upper,
+        static_extent_v<std::remove_cv_t<R>>));
+
+/// Accesses an element of a range with a constrained index
+/// @param range range with a size known at compile time
+/// @param i index with bounds within the range
+///
+/// As the bounds of `i` are verified at compile time, the element is accessed
+/// without a runtime bounds check. Validation of the index occurs where the
+/// index is constructed.
+///
+/// ~~~{.cpp}
+/// auto table = std::array<float, 16>{};
+/// const auto i = index_for<16>{std::size_t{7}};
+/// get(table, i) = 1.0F;
+/// ~~~
+///
+template <std::ranges::contiguous_range R, index_of<R> I>
+[[nodiscard]] constexpr auto get(R& range, const I& i) noexcept
+    -> std::ranges::range_reference_t<R&>
+{
+  const auto n = detail::wrapping_cast<std::size_t>(i.value());
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  return std::ranges::data(range)[n];
+}
+
+}  // namespace constrained_value
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "src/constrained_value.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace constrained_value {
+namespace detail {
+
+// Not defined and not `constexpr`. Invoking this function during constant
+// evaluation results in a compile error that names the failure.
+auto literal_not_representable_by_underlying_type() -> void;
+auto literal_exceeds_long_long() -> void;
+auto value_not_representable_by_underlying_type() -> void;
+auto constant_does_not_satisfy_invariant() -> void;
+
+// Converts a value to `To` during constant evaluation. Conversions that change
+// an integral value, or the integral value of a floating point value, fail to
+// compile. Floating point values are rounded to a floating point `To` but may
+// not overflow.
+template <typename To, typename From>
+consteval auto exact_convert(const From& value) -> To
+{
+  if constexpr (std::same_as<To, From>) {
+    return value;
+  } else if constexpr (std::integral<To> and std::integral<From>) {
+    if (not std::in_range<To>(value)) {
+      value_not_representable_by_underlying_type();
+    }
+    return static_cast<To>(value);
+  } else if constexpr (std::floating_point<To> and std::floating_point<From>) {
+    // `x - x` is zero only if `x` is finite
+    const auto result = static_cast<To>(value);
+    if ((result - result != To{}) and (value - value == From{})) {
+      value_not_representable_by_underlying_type();
+    }
+    return result;
+  } else if constexpr (
+      std::is_arithmetic_v<To> and std::is_arithmetic_v<From>) {
+    const auto result = static_cast<To>(value);
+    if (static_cast<From>(result) != value) {
+      value_not_representable_by_underlying_type();
+    }
+    return result;
+  } else {
+    return To(value);
+  }
+}
+
+// Checks the invariant of `CV` directly, as the violation policy may be a
+// constant expression that returns without failing compilation
+template <typename CV>
+consteval auto make_checked(typename CV::underlying_type value) -> CV
+{
+  if (not std::invoke(typename CV::predicate_type{}, std::as_const(value))) {
+    constant_does_not_satisfy_invariant();
+  }
+  return CV{unchecked, std::move(value)};
+}
+
+template <typename CV, typename U, std::size_t N, std::size_t... Is>
+consteval auto make_constant_array_impl(
+    const std::array<U, N>& values, std::index_sequence<Is...>)
+    -> std::array<CV, N>
+{
+  return {make_checked<CV>(
+      exact_convert<typename CV::underlying_type>(values[Is]))...};
+}
+
+}  // namespace detail
+
+/// Constructs a constrained_value during compilation
+/// @tparam CV `constrained_value` type
+/// @param value value of the underlying type
+///
+/// The invariant is always checked at compile time. An invariant violation
+/// results in a compile error, independent of the violation policy.
+///
+/// ~~~{.cpp}
+/// constexpr auto half = make_constant<bounded<double, 0, 1>>(0.5);
+/// ~~~
+///
+template <typename CV>
+  requires is_constrained_value_v<CV>
+[[nodiscard]] consteval auto
+make_constant(typename CV::underlying_type value) -> CV
+{
+  return detail::make_checked<CV>(std::move(value));
+}
+
+/// Constructs an array of constrained_values during compilation
+/// @tparam CV `constrained_value` type
+/// @param values values of the underlying type
+///
+/// Each invariant is checked at compile time, independent of the violation
+/// policy. Values that are changed by conversion to the underlying type, such
+/// as `1.5` for an integral type, result in a compile error. If the result
+/// initializes a
+/// `constexpr` or `constinit` variable with static storage duration, the array
+/// is constant-initialized, requiring no runtime checks or dynamic
+/// initialization.
+///
+/// ~~~{.cpp}
+/// static constexpr auto gains =
+///     make_constant_array<bounded<double, 0, 1>>(0.0, 0.25, 0.5, 1.0);
+/// ~~~
+///
+/// @{
+template <typename CV, typename... Ts>
+  requires (
+      is_constrained_value_v<CV> and
+      (std::convertible_to<Ts, typename CV::underlying_type> and ...))
+[[nodiscard]] consteval auto make_constant_array(Ts... values)
+    -> std::array<CV, sizeof...(Ts)>
+{
+  return {detail::make_checked<CV>(
+      detail::exact_convert<typename CV::underlying_type>(values))...};
+}
+
+template <typename CV, typename U, std::size_t N>
+  requires (
+      is_constrained_value_v<CV> and
+      std::convertible_to<U, typename CV::underlying_type>)
+[[nodiscard]] consteval auto make_constant_array(const std::array<U, N>& values)
+    -> std::array<CV, N>
+{
+  return detail::make_constant_array_impl<CV>(
+      values, std::make_index_sequence<N>{});
+}
+/// @}
+
+/// User-defined literals for constrained values
+///
+namespace literals {
+namespace detail {
+
+/// Arithmetic literal implicitly convertible to a constrained_value at compile
+///     time
+///
+template <typename T>
+struct checked_literal
+{
+  T value;
+
+  [[nodiscard]] friend consteval auto
+  operator-(checked_literal x) noexcept -> checked_literal
+  {
+    return {-x.value};
+  }
+
+  template <typename CV>
+    requires (
+        is_constrained_value_v<CV> and
+        (std::integral<typename CV::underlying_type> or
+         std::floating_point<typename CV::underlying_type>) and
+        (std::integral<typename CV::underlying_type> ==
+         std::integral<T>))
+  [[nodiscard]] consteval operator CV() const
+  {
+    using U = typename CV::underlying_type;
+
+    if constexpr (std::integral<U>) {
+      if (not std::in_range<U>(value)) {
+        ::constrained_value::detail::
+            literal_not_representable_by_underlying_type();
+      }
+    }
+
+    if constexpr (std::same_as<U, T>) {
+      return ::constrained_value::detail::make_checked<CV>(value);
+    } else {
+      return ::constrained_value::detail::make_checked<CV>(
+          static_cast<U>(value));
+    }
+  }
+};
+
+}  // namespace detail
+
+/// Creates a literal that converts to a constrained_value at compile time
+///
+/// The invariant of the target `constrained_value` is checked at compile
+/// time. Floating point literals are rounded to the underlying type.
+///
+/// ~~~{.cpp}
+/// using namespace constrained_value::literals;
+///
+/// constexpr bounded<double, 0, 1> half = 0.5_cv;
+/// constexpr negative<int> x = -1_cv;
+/// ~~~
+///
+/// @{
+[[nodiscard]] consteval auto operator""_cv(unsigned long long value)
+    -> detail::checked_literal<long long>
+{
+  if (value > static_cast<unsigned long long>(
+                  std::numeric_limits<long long>::max())) {
+    ::constrained_value::detail::literal_exceeds_long_long();
+  }
+  return {static_cast<long long>(value)};
+}
+
+[[nodiscard]] consteval auto operator""_cv(long double value)
+    -> detail::checked_literal<long double>
+{
+  return {value};
+}
+/// @}
+
+}  // namespace literals
+}  // namespace constrained_value
@@ -0,0 +1,183 @@
+#pragma once
+
+#if __has_include(<sys/mman.h>)
+
+#include "src/constrained_value.hpp"
+#include "src/detail/validate.hpp"
+#include "src/source_location.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace constrained_value {
+
+/// A read-only, memory-mapped array of constrained values
+/// @tparam CV `constrained_value` type of each element
+///
+/// Maps a flat binary file of `CV::underlying_type` values into memory and
+/// validates every value in a single sequential pass. Elements that do not
+/// satisfy the invariant are passed to the violation policy of `CV`. After
+/// construction, the mapped file is viewed as a sequence of `CV` without
+/// copying.
+///
+/// ~~~{.cpp}
+/// const auto samples = mapped_array<nonnegative<double>>{"samples.bin"};
+/// for (nonnegative<double> x : samples) { ... }
+/// ~~~
+///
+/// @note The file is mapped privately and read-only. Modifying the file while
+///     it is mapped results in unspecified values.
+///
+template <typename CV>
+  requires layout_compatible_with_underlying<CV>
+class mapped_array
+{
+  using T = typename CV::underlying_type;
+  using P = typename CV::predicate_type;
+  using V = typename CV::violation_policy_type;
+
+  const CV* data_{};
+  std::size_t size_{};
+
+  [[noreturn]] static auto throw_system_error(int error, const char* what)
+      -> void
+  {
+    throw std::system_error{error, std::generic_category(), what};
+  }
+
+  auto unmap() noexcept -> void
+  {
+    if (data_ != nullptr) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      ::munmap(const_cast<CV*>(data_), size_ * sizeof(CV));
+    }
+  }
+
+public:
+  using value_type = CV;
+  using size_type = std::size_t;
+  using const_iterator = typename std::span<const CV>::iterator;
+
+  /// Map and validate a file
+  /// @param path path of a file containing values of `CV::underlying_type`
+  /// @throws std::system_error if the file cannot be opened or mapped, or if
+  ///     the file size is not a multiple of `sizeof(CV::underlying_type)`
+  /// @pre each value in the file satisfies `CV::predicate_type`
+  ///
+  explicit mapped_array(
+      const std::filesystem::path& path,
+      source_location sl = source_location::current())
+  {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    const auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+      throw_system_error(errno, "open");
+    }
+
+    struct ::stat st
+    {};
+    if (::fstat(fd, &st) == -1) {
+      const auto error = errno;
+      ::close(fd);
+      throw_system_error(error, "fstat");
+    }
+
+    const auto bytes = static_cast<std::size_t>(st.st_size);
+    if (bytes % sizeof(T) != 0) {
+      ::close(fd);
+      throw std::system_error{
+          std::make_error_code(std::errc::invalid_argument),
+          "file size is not a multiple of the element size"};
+    }
+
+    if (bytes == 0) {
+      ::close(fd);
+      return;
+    }
+
+    auto* const addr =
+        ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, off_t{});
+    const auto mmap_error = errno;
+    ::close(fd);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    if (addr == MAP_FAILED) {
+      throw_system_error(mmap_error, "mmap");
+    }
+
+    // advisory only, a failure does not affect correctness
+    ::madvise(addr, bytes, MADV_SEQUENTIAL);
+
+    data_ = static_cast<const CV*>(addr);
+    size_ = bytes / sizeof(T);
+
+    try {
+      detail::validate_each<P, V>(
+          static_cast<const T*>(addr), size_, __PRETTY_FUNCTION__, sl);
+    } catch (...) {
+      unmap();
+      throw;
+    }
+
+    ::madvise(addr, bytes, MADV_NORMAL);
+  }
+
+  mapped_array(const mapped_array&) = delete;
+  auto operator=(const mapped_array&) -> mapped_array& = delete;
+
+  mapped_array(mapped_array&& other) noexcept
+      : data_{std::exchange(other.data_, nullptr)},
+        size_{std::exchange(other.size_, {})}
+  {}
+
+  auto operator=(mapped_array&& other) noexcept -> mapped_array&
+  {
+    if (this != &other) {
+      unmap();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, {});
+    }
+    return *this;
+  }
+
+  ~mapped_array() { unmap(); }
+
+  /// Returns a view of the mapped values
+  ///
+  [[nodiscard]] auto span() const noexcept -> std::span<const CV>
+  {
+    return {data_, size_};
+  }
+
+  /// Container interface
+  /// @{
+  [[nodiscard]] auto data() const noexcept -> const CV* { return data_; }
+  [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator
+  {
+    return span().begin();
+  }
+  [[nodiscard]] auto end() const noexcept -> const_iterator
+  {
+    return span().end();
+  }
+  [[nodiscard]] auto operator[](size_type i) const noexcept -> const CV&
+  {
+    return span()[i];
+  }
+  /// @}
+};
+
+}  // namespace constrained_value
+
+#endif
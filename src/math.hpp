@@ -12,8 +12,31 @@
 #include <type_traits>
 
 namespace constrained_value::math {
+namespace detail {
+
+// Overloads found by argument-dependent lookup, e.g. for
+// `std::experimental::simd`
+template <typename T>
+constexpr auto adl_abs(const T& value) noexcept(noexcept(abs(value)))
+    -> decltype(abs(value))
+{
+  return abs(value);
+}
+
+template <typename T>
+constexpr auto adl_isfinite(const T& value) noexcept(noexcept(isfinite(value)))
+    -> decltype(isfinite(value))
+{
+  return isfinite(value);
+}
+
+}  // namespace detail
 
 /// Computes the absolute value of a totally ordered number
+///
+/// Other types, such as `std::experimental::simd`, use `abs` found by
+/// argument-dependent lookup.
+///
 /// @see https://en.cppreference.com/w/cpp/numeric/math/fabs
 ///
 // TODO add this as a case to `projection::abs`
@@ -33,6 +56,15 @@ inline constexpr struct
 
     return (T{} < value) ? value : -value;
   }
+
+  template <typename T>
+    requires (not std::totally_ordered<T>)
+  [[nodiscard]] constexpr auto operator()(const T& value) const
+      noexcept(noexcept(detail::adl_abs(value)))
+          -> decltype(detail::adl_abs(value))
+  {
+    return detail::adl_abs(value);
+  }
 } abs{};
 
 /// Determines if a value is non-a-number
@@ -65,6 +97,10 @@ inline constexpr struct
 } isinf{};
 
 /// Determines if a number if has a finite value
+///
+/// Types that are not `numeric`, such as `std::experimental::simd`, use
+/// `isfinite` found by argument-dependent lookup.
+///
 /// @see https://en.cppreference.com/w/cpp/numeric/math/isfinite
 ///
 inline constexpr struct
@@ -75,6 +111,15 @@ inline constexpr struct
   {
     return not(isnan(value) or isinf(value));
   }
+
+  template <typename T>
+    requires (not numeric<T>)
+  [[nodiscard]] constexpr auto operator()(const T& value) const
+      noexcept(noexcept(detail::adl_isfinite(value)))
+          -> decltype(detail::adl_isfinite(value))
+  {
+    return detail::adl_isfinite(value);
+  }
 } isfinite{};
 
 /// Determines if the IEC 559 bit representation of a number has a negative sign
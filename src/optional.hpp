@@ -0,0 +1,177 @@
+#pragma once
+
+#include "src/bitwise_integer.hpp"
+#include "src/constrained_value.hpp"
+
+#include <array>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace constrained_value {
+namespace detail {
+
+template <typename T>
+consteval auto sentinel_candidates() noexcept
+{
+  using L = std::numeric_limits<T>;
+
+  if constexpr (L::has_quiet_NaN and L::has_infinity) {
+    return std::array<T, 6>{
+        L::quiet_NaN(), -L::infinity(), L::infinity(), L::lowest(), L::max(),
+        T{}};
+  } else {
+    return std::array<T, 3>{L::lowest(), L::max(), T{}};
+  }
+}
+
+// Returns a value of `T` that does not satisfy `P`, if one is found among
+// the extreme values of `T`
+template <typename T, typename P>
+consteval auto find_sentinel() -> std::optional<T>
+{
+  for (auto candidate : sentinel_candidates<T>()) {
+    if (not std::invoke(P{}, std::as_const(candidate))) {
+      return candidate;
+    }
+  }
+  return std::nullopt;
+}
+
+// `P` may not be invocable during constant evaluation
+template <typename T, typename P>
+concept constant_sentinel_search = requires {
+  typename std::bool_constant<find_sentinel<T, P>().has_value()>;
+};
+
+}  // namespace detail
+
+/// Specifies that a `constrained_value` has an underlying value, known at
+///     compile time, that does not satisfy its invariant
+///
+/// Candidates are NaN, infinities, the extreme values of the underlying type,
+/// and `T{}`.
+///
+template <typename CV>
+concept has_sentinel =
+    is_constrained_value_v<CV> and
+    std::is_arithmetic_v<typename CV::underlying_type> and
+    bitwise_integer_reinterpretable<typename CV::underlying_type> and
+    detail::constant_sentinel_search<
+        typename CV::underlying_type,
+        typename CV::predicate_type> and
+    detail::find_sentinel<
+        typename CV::underlying_type,
+        typename CV::predicate_type>()
+        .has_value();
+
+/// An optional constrained value with the same size as its underlying type
+/// @tparam CV `constrained_value` type
+///
+/// An empty `optional` stores a value of the underlying type that does not
+/// satisfy the invariant of `CV`. Emptiness is determined by comparing the
+/// object representation with this sentinel, so that sentinels such as NaN
+/// are detected.
+///
+/// Provides a subset of the `std::optional` interface. As no `CV` object is
+/// stored, the contained value is returned by value.
+///
+/// ~~~{.cpp}
+/// static_assert(sizeof(optional<positive<int>>) == sizeof(int));
+///
+/// auto x = optional<positive<double>>{};  // stores NaN
+/// x = positive<double>{0.5};
+/// ~~~
+///
+/// @note Use `std::optional` for `constrained_value` types without a sentinel.
+///
+template <has_sentinel CV>
+class optional
+{
+  using T = typename CV::underlying_type;
+
+  static constexpr auto sentinel =
+      *detail::find_sentinel<T, typename CV::predicate_type>();
+
+  T storage_{sentinel};
+
+public:
+  using value_type = CV;
+
+  /// Construct an empty optional
+  /// @{
+  constexpr optional() noexcept = default;
+  constexpr optional(std::nullopt_t) noexcept {}
+  /// @}
+
+  /// Construct an optional containing a value
+  ///
+  constexpr optional(const CV& value) noexcept : storage_{value.value()} {}
+
+  /// Checks if the optional contains a value
+  /// @{
+  [[nodiscard]] constexpr auto has_value() const noexcept -> bool
+  {
+    return bitwise_integer_reinterpretation(storage_) !=
+           bitwise_integer_reinterpretation(sentinel);
+  }
+  [[nodiscard]] constexpr explicit operator bool() const noexcept
+  {
+    return has_value();
+  }
+  /// @}
+
+  /// Returns the contained value
+  /// @pre `has_value()`
+  ///
+  [[nodiscard]] constexpr auto operator*() const noexcept -> CV
+  {
+    return CV{unchecked, storage_};
+  }
+
+  /// Returns the contained value
+  /// @throws std::bad_optional_access if the optional is empty
+  ///
+  [[nodiscard]] constexpr auto value() const -> CV
+  {
+    if (not has_value()) {
+      throw std::bad_optional_access{};
+    }
+    return **this;
+  }
+
+  /// Returns the contained value or `default_value` if empty
+  ///
+  [[nodiscard]] constexpr auto value_or(const CV& default_value) const noexcept
+      -> CV
+  {
+    return has_value() ? **this : default_value;
+  }
+
+  /// Destroys the contained value
+  ///
+  constexpr auto reset() noexcept -> void { storage_ = sentinel; }
+
+  /// Comparison operators
+  /// @{
+  [[nodiscard]] friend constexpr auto
+  operator==(const optional& x, const optional& y) noexcept -> bool
+  {
+    if (x.has_value() != y.has_value()) {
+      return false;
+    }
+    return not x.has_value() or (*x == *y);
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator==(const optional& x, std::nullopt_t) noexcept -> bool
+  {
+    return not x.has_value();
+  }
+  /// @}
+};
+
+}  // namespace constrained_value
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "src/bounds.hpp"
+#include "src/constrained_value.hpp"
+#include "src/detail/validate.hpp"
+#include "src/detail/wrapping_cast.hpp"
+#include "src/source_location.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace constrained_value {
+
+/// A dynamically sized array of bounded integers stored with the minimal
+///     number of bits
+/// @tparam CV `constrained_value` type with integral underlying type and
+///     inclusive bounds
+///
+/// Each value is stored as an offset from the lower bound using the number of
+/// bits required to represent `upper - lower`. Values are packed into 64-bit
+/// words and never span a word boundary, so that random access requires a
+/// single load and each word is packed or unpacked with a fixed number of
+/// shifts. Bulk operations process whole words in branch-free loops that may
+/// be vectorized.
+///
+/// ~~~{.cpp}
+/// auto categories = packed_array<bounded<int, 0, 15>>{};
+/// categories.append(raw);  // 4 bits per value
+///
+/// const bounded<int, 0, 15> x = categories[i];
+/// ~~~
+///
+template <typename CV>
+  requires (
+      bounded_value<CV> and std::integral<typename CV::underlying_type> and
+      std::integral<decltype(bounds_of<typename CV::predicate_type>::lower)> and
+      std::integral<decltype(bounds_of<typename CV::predicate_type>::upper)>)
+class packed_array
+{
+  using T = typename CV::underlying_type;
+  using P = typename CV::predicate_type;
+  using V = typename CV::violation_policy_type;
+  using word_type = std::uint64_t;
+
+  static constexpr auto lower =
+      detail::wrapping_cast<word_type>(bounds_of<P>::lower);
+  static constexpr auto range =
+      detail::wrapping_cast<word_type>(bounds_of<P>::upper) - lower;
+
+public:
+  /// Number of bits used to store each value
+  ///
+  static constexpr auto bits_per_value =
+      std::max(std::size_t{1}, static_cast<std::size_t>(std::bit_width(range)));
+
+  /// Number of values stored in each 64-bit word
+  ///
+  static constexpr auto values_per_word = 64 / bits_per_value;
+
+private:
+  static constexpr auto mask = (bits_per_value == 64)
+                                   ? ~word_type{}
+                                   : (word_type{1} << bits_per_value) - 1;
+
+  std::vector<word_type> words_;
+  std::size_t size_{};
+
+  static constexpr auto encode(const T& value) noexcept -> word_type
+  {
+    return detail::wrapping_cast<word_type>(value) - lower;
+  }
+
+  static constexpr auto decode(word_type code) noexcept -> T
+  {
+    return detail::wrapping_cast<T>(code + lower);
+  }
+
+  static constexpr auto shift(std::size_t i) noexcept -> std::size_t
+  {
+    return (i % values_per_word) * bits_per_value;
+  }
+
+  auto store(std::size_t i, word_type code) noexcept -> void
+  {
+    auto& word = words_[i / values_per_word];
+    word = (word & ~(mask << shift(i))) | (code << shift(i));
+  }
+
+public:
+  using value_type = CV;
+  using size_type = std::size_t;
+
+  /// Container interface
+  /// @{
+  [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+  auto reserve(size_type n) -> void
+  {
+    words_.reserve((n + values_per_word - 1) / values_per_word);
+  }
+  auto clear() noexcept -> void
+  {
+    words_.clear();
+    size_ = 0;
+  }
+
+  [[nodiscard]] auto operator[](size_type i) const noexcept -> CV
+  {
+    return CV{
+        unchecked,
+        decode((words_[i / values_per_word] >> shift(i)) & mask)};
+  }
+  /// @}
+
+  /// Replaces the value at position `i`
+  ///
+  auto set(size_type i, const CV& value) noexcept -> void
+  {
+    store(i, encode(value.value()));
+  }
+
+  /// Appends a value
+  ///
+  auto push_back(const CV& value) -> void
+  {
+    if (size_ % values_per_word == 0) {
+      words_.push_back(word_type{});
+    }
+    store(size_++, encode(value.value()));
+  }
+
+  /// Validates and appends values of the underlying type
+  /// @param values values to append
+  /// @pre each value satisfies the invariant of `CV`
+  ///
+  /// Values are validated in bulk before any value is appended. If the
+  /// violation policy returns, no values are appended.
+  ///
+  auto append(
+      std::span<const T> values,
+      source_location sl = source_location::current()) -> void
+  {
+    if (not detail::validate_each<P, V>(
+            values.data(), values.size(), __PRETTY_FUNCTION__, sl)) {
+      return;
+    }
+
+    reserve(size_ + values.size());
+
+    auto first = values.begin();
+
+    // fill the partially filled last word
+    while (first != values.end() and size_ % values_per_word != 0) {
+      store(size_++, encode(*first++));
+    }
+
+    // pack whole words
+    while (values.end() - first >= std::ptrdiff_t{values_per_word}) {
+      auto word = word_type{};
+      for (auto k = std::size_t{}; k != values_per_word; ++k) {
+        word |= encode(first[static_cast<std::ptrdiff_t>(k)])
+                << (k * bits_per_value);
+      }
+      words_.push_back(word);
+      first += std::ptrdiff_t{values_per_word};
+      size_ += values_per_word;
+    }
+
+    if (first != values.end()) {
+      words_.push_back(word_type{});
+    }
+    while (first != values.end()) {
+      store(size_++, encode(*first++));
+    }
+  }
+
+  /// Copies all values to a range of the underlying type
+  /// @param out destination with at least `size()` elements
+  ///
+  auto unpack(std::span<T> out) const noexcept -> void
+  {
+    const auto full_words = size_ / values_per_word;
+
+    auto it = out.begin();
+    for (auto w = std::size_t{}; w != full_words; ++w) {
+      const auto word = words_[w];
+      for (auto k = std::size_t{}; k != values_per_word; ++k) {
+        it[static_cast<std::ptrdiff_t>(k)] =
+            decode((word >> (k * bits_per_value)) & mask);
+      }
+      it += std::ptrdiff_t{values_per_word};
+    }
+
+    for (auto i = full_words * values_per_word; i != size_; ++i) {
+      *it++ = decode((words_[i / values_per_word] >> shift(i)) & mask);
+    }
+  }
+
+  /// Returns the packed representation
+  ///
+  [[nodiscard]] auto words() const noexcept -> std::span<const word_type>
+  {
+    return words_;
+  }
+};
+
+}  // namespace constrained_value
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "src/constrained_value.hpp"
+#include "src/detail/assume.hpp"
+#include "src/functional.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace constrained_value {
+namespace predicate {
+
+/// Checks if a pointer is not null
+///
+/// Unary predicate function object that compares a value with `nullptr`.
+/// Applicable to raw pointers and to smart pointers.
+///
+/// ~~~{.cpp}
+/// auto x = 0;
+/// not_null{}(&x);      // true
+/// not_null{}(nullptr); // false
+/// ~~~
+///
+struct not_null
+{
+  template <typename T>
+    requires requires (const T& ptr) {
+      { ptr != nullptr } -> std::convertible_to<bool>;
+    }
+  [[nodiscard]] constexpr auto operator()(const T& ptr) const
+      noexcept(noexcept(ptr != nullptr)) -> bool
+  {
+    return ptr != nullptr;
+  }
+};
+
+/// Checks if a pointer is aligned to a boundary
+/// @tparam N alignment in bytes, a power of two
+///
+/// Unary predicate function object. A null pointer is aligned to every
+/// boundary. As the address of a pointer is not a constant expression, this
+/// predicate cannot be evaluated during constant evaluation.
+///
+/// ~~~{.cpp}
+/// alignas(64) auto buffer = std::array<float, 16>{};
+/// aligned<64>{}(buffer.data());     // true
+/// aligned<64>{}(buffer.data() + 1); // false
+/// ~~~
+///
+template <std::size_t N>
+  requires (std::has_single_bit(N))
+struct aligned
+{
+  template <typename T>
+  [[nodiscard]] auto operator()(T* ptr) const noexcept -> bool
+  {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return (reinterpret_cast<std::uintptr_t>(ptr) & (N - 1)) == 0;
+  }
+};
+
+}  // namespace predicate
+
+/// Obtains the alignment guaranteed by a predicate
+/// @tparam P predicate type
+///
+/// Provides the static data member `value`, equal to `N` for
+/// `predicate::aligned<N>` and to the greatest alignment of any predicate in a
+/// `functional::all_of`. Equal to one for other predicates.
+///
+/// @{
+template <typename P>
+struct alignment_of : std::integral_constant<std::size_t, 1>
+{};
+
+template <std::size_t N>
+struct alignment_of<predicate::aligned<N>>
+    : std::integral_constant<std::size_t, N>
+{};
+
+template <typename... Ps>
+struct alignment_of<functional::all_of<Ps...>>
+    : std::integral_constant<
+          std::size_t,
+          std::max({std::size_t{1}, alignment_of<Ps>::value...})>
+{};
+/// @}
+
+/// Checks if a predicate guarantees a non-null value
+/// @tparam P predicate type
+///
+/// `true` for `predicate::not_null` and a `functional::all_of` containing it.
+///
+/// @{
+template <typename P>
+inline constexpr auto excludes_null_v = false;
+
+template <>
+inline constexpr auto excludes_null_v<predicate::not_null> = true;
+
+template <typename... Ps>
+inline constexpr auto excludes_null_v<functional::all_of<Ps...>> =
+    (excludes_null_v<Ps> or ...);
+/// @}
+
+/// Returns a constrained pointer, allowing the optimizer to assume its
+///     invariant
+/// @param ptr constrained pointer
+///
+/// Applies `std::assume_aligned` with the alignment guaranteed by the
+/// predicate of `ptr` and, if the predicate excludes null pointers, informs
+/// the optimizer that the returned pointer is not null. Loops reading through
+/// the returned pointer can be compiled without alignment prologues or null
+/// checks.
+///
+/// ~~~{.cpp}
+/// auto sum(aligned_ptr<const float, 64> data, std::size_t n) -> float
+/// {
+///   const auto* p = assume_aligned(data);
+///   ...
+/// }
+/// ~~~
+///
+template <typename CV>
+  requires (
+      is_constrained_value_v<CV> and
+      std::is_pointer_v<typename CV::underlying_type>)
+[[nodiscard]] constexpr auto assume_aligned(const CV& ptr) noexcept ->
+    typename CV::underlying_type
+{
+  using P = typename CV::predicate_type;
+
+  if constexpr (excludes_null_v<P>) {
+    detail::assume(ptr.value() != nullptr);
+  }
+  return std::assume_aligned<alignment_of<P>::value>(ptr.value());
+}
+
+}  // namespace constrained_value
@@ -1,14 +1,139 @@
 #pragma once
 
 #include "src/constant.hpp"
+#include "src/detail/pairwise_sum.hpp"
+#include "src/detail/priority.hpp"
 #include "src/functional.hpp"
+#include "src/projection.hpp"
 
+#include <concepts>
+#include <cstddef>
 #include <functional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 // NOLINTNEXTLINE(modernize-concat-nested-namespaces)
 namespace constrained_value {
+namespace detail {
+
+// Specifies a type with lane-wise operations, such as
+// `std::experimental::simd`, that can be constructed by broadcasting a scalar
+template <typename T>
+concept lanes = requires {
+  typename T::value_type;
+  typename T::mask_type;
+} and std::constructible_from<T, typename T::value_type>;
+
+// Applies `R`, a constrained comparison from `std::ranges`, if the arguments
+// satisfy its constraints. Otherwise applies the unconstrained comparison `F`,
+// which may return a mask for types with lane-wise comparison operators.
+// Scalars compared with lanes are explicitly broadcast first, as a conversion
+// from a constant such as `constant::Zero` to the lane type is ambiguous.
+template <std::default_initializable R, std::default_initializable F>
+class comparison
+{
+  template <typename T, typename U>
+    requires std::invocable<const R&, T, U>
+  static constexpr auto impl(priority<2>, T&& t, U&& u) noexcept(
+      noexcept(R{}(std::forward<T>(t), std::forward<U>(u))))
+      -> decltype(R{}(std::forward<T>(t), std::forward<U>(u)))
+  {
+    return R{}(std::forward<T>(t), std::forward<U>(u));
+  }
+
+  template <typename T, typename U, typename L = std::remove_cvref_t<T>>
+    requires (
+        lanes<L> and not std::same_as<std::remove_cvref_t<U>, L> and
+        std::convertible_to<U, typename L::value_type>)
+  static constexpr auto impl(priority<1>, T&& t, U&& u)
+      -> decltype(F{}(std::forward<T>(t), std::declval<const L&>()))
+  {
+    using V = typename L::value_type;
+
+    if constexpr (std::same_as<std::remove_cvref_t<U>, V>) {
+      return F{}(std::forward<T>(t), L(std::forward<U>(u)));
+    } else {
+      return F{}(std::forward<T>(t), L(static_cast<V>(std::forward<U>(u))));
+    }
+  }
+
+  template <typename T, typename U>
+  static constexpr auto impl(priority<0>, T&& t, U&& u) noexcept(
+      noexcept(F{}(std::forward<T>(t), std::forward<U>(u))))
+      -> decltype(F{}(std::forward<T>(t), std::forward<U>(u)))
+  {
+    return F{}(std::forward<T>(t), std::forward<U>(u));
+  }
+
+public:
+  template <typename T, typename U>
+  constexpr auto operator()(T&& t, U&& u) const noexcept(
+      noexcept(impl(priority<2>{}, std::forward<T>(t), std::forward<U>(u))))
+      -> decltype(impl(priority<2>{}, std::forward<T>(t), std::forward<U>(u)))
+  {
+    return impl(priority<2>{}, std::forward<T>(t), std::forward<U>(u));
+  }
+};
+
+// Unconstrained comparisons defined in terms of `<`, as are
+// `std::ranges::less_equal` and `std::ranges::greater_equal`. Unlike `<=` and
+// `>=`, these are satisfied if either argument is NaN, so lanes are compared
+// with the same semantics as scalars.
+struct not_greater
+{
+  template <typename T, typename U>
+  constexpr auto operator()(T&& t, U&& u) const
+      noexcept(noexcept(not (std::forward<U>(u) < std::forward<T>(t))))
+          -> decltype(not (std::forward<U>(u) < std::forward<T>(t)))
+  {
+    return not (std::forward<U>(u) < std::forward<T>(t));
+  }
+};
+
+struct not_less
+{
+  template <typename T, typename U>
+  constexpr auto operator()(T&& t, U&& u) const
+      noexcept(noexcept(not (std::forward<T>(t) < std::forward<U>(u))))
+          -> decltype(not (std::forward<T>(t) < std::forward<U>(u)))
+  {
+    return not (std::forward<T>(t) < std::forward<U>(u));
+  }
+};
+
+// Checks if an integer is a multiple of another integer of the same type.
+// Only zero is a multiple of zero. Every integer is a multiple of -1, which is
+// handled separately as the remainder of the minimum value divided by -1 is
+// undefined.
+struct is_multiple_of
+{
+  template <std::integral T>
+  constexpr auto operator()(T t, T u) const noexcept -> bool
+  {
+    if (u == 0) {
+      return t == 0;
+    }
+    if constexpr (std::is_signed_v<T>) {
+      if (u == -1) {
+        return true;
+      }
+    }
+    return t % u == 0;
+  }
+};
+
+}  // namespace detail
 
 /// Common predicates used in defining type invariants
+///
+/// Comparison predicates use the `std::ranges` comparison function objects
+/// for totally ordered types. Types with lane-wise comparison operators, such
+/// as `std::experimental::simd`, are compared with lane-wise operators that
+/// have the same semantics, including for NaN, and the predicate returns a
+/// mask.
+///
 namespace predicate {
 
 /// Checks if a value is equal to another value
@@ -24,7 +149,9 @@ namespace predicate {
 /// equal_to{}(3.0, 3.1); // false
 /// ~~~
 ///
-struct equal_to : functional::nttp_bindable<std::ranges::equal_to>
+struct equal_to
+    : functional::nttp_bindable<
+          detail::comparison<std::ranges::equal_to, std::equal_to<>>>
 {};
 
 /// Checks if a value is not equal to another value
@@ -40,7 +167,9 @@ struct equal_to : functional::nttp_bindable<std::ranges::equal_to>
 /// not_equal_to{}(3.0, 3.1); // true
 /// ~~~
 ///
-struct not_equal_to : functional::nttp_bindable<std::ranges::not_equal_to>
+struct not_equal_to
+    : functional::nttp_bindable<
+          detail::comparison<std::ranges::not_equal_to, std::not_equal_to<>>>
 {};
 
 /// Checks if one value is less than another value
@@ -56,7 +185,9 @@ struct not_equal_to : functional::nttp_bindable<std::ranges::not_equal_to>
 /// less{}(-3.0, 0.0); // true
 /// ~~~
 ///
-struct less : functional::nttp_bindable<std::ranges::less>
+struct less
+    : functional::nttp_bindable<
+          detail::comparison<std::ranges::less, std::less<>>>
 {};
 
 /// Checks if one value is less than or equal to another value
@@ -72,7 +203,9 @@ struct less : functional::nttp_bindable<std::ranges::less>
 /// less_equal{}(-3.0, 0.0); // true
 /// ~~~
 ///
-struct less_equal : functional::nttp_bindable<std::ranges::less_equal>
+struct less_equal
+    : functional::nttp_bindable<
+          detail::comparison<std::ranges::less_equal, detail::not_greater>>
 {};
 
 /// Checks if one value is greater than another value
@@ -88,7 +221,9 @@ struct less_equal : functional::nttp_bindable<std::ranges::less_equal>
 /// greater{}(-3.0, 0.0); // false
 /// ~~~
 ///
-struct greater : functional::nttp_bindable<std::ranges::greater>
+struct greater
+    : functional::nttp_bindable<
+          detail::comparison<std::ranges::greater, std::greater<>>>
 {};
 
 /// Checks if one value is greater than or equal to another value
@@ -104,7 +239,25 @@ struct greater : functional::nttp_bindable<std::ranges::greater>
 /// greater_equal{}(-3.0, 0.0); // false
 /// ~~~
 ///
-struct greater_equal : functional::nttp_bindable<std::ranges::greater_equal>
+struct greater_equal
+    : functional::nttp_bindable<
+          detail::comparison<std::ranges::greater_equal, detail::not_less>>
+{};
+
+/// Checks if an integer is a multiple of another integer
+///
+/// Binary predicate function object. This function object allows a non-type
+/// template parameter to be bound to the divisor. Both arguments must have the
+/// same type.
+///
+/// ~~~{.cpp}
+/// multiple_of{}(12, 4); // true
+/// multiple_of{}(12, 5); // false
+/// multiple_of{}(0, 5);  // true
+/// multiple_of{}(5, 0);  // false
+/// ~~~
+///
+struct multiple_of : functional::nttp_bindable<detail::is_multiple_of>
 {};
 
 /// Checks if a value is less than zero
@@ -167,6 +320,105 @@ struct positive : greater::bind_back<constant::Zero{}>
 struct nonpositive : less_equal::bind_back<constant::Zero{}>
 {};
 
+/// Checks if the number of elements of a range is a multiple of `N`
+/// @tparam N required multiple, nonzero
+///
+/// Used to define spans that a vectorized loop can process `N` elements at a
+/// time without a remainder loop. See `assume_size`.
+///
+/// ~~~{.cpp}
+/// using block = constrained_value<
+///     std::span<float>,
+///     predicate::size_multiple_of<16>>;
+/// ~~~
+///
+template <std::size_t N>
+  requires (N != 0)
+struct size_multiple_of
+    : functional::compose<projection::size, multiple_of::bind_back<N>>
+{};
+
+/// Checks if a range has at least `N` elements
+/// @tparam N minimum number of elements
+///
+/// ~~~{.cpp}
+/// using nonempty = constrained_value<
+///     std::span<const int>,
+///     predicate::size_at_least<1>>;
+/// ~~~
+///
+template <std::size_t N>
+struct size_at_least
+    : functional::compose<projection::size, greater_equal::bind_back<N>>
+{};
+
+/// Checks if the squared magnitude of a value is one within a tolerance
+/// @tparam tol tolerance of the squared magnitude, e.g. `constant::ulp<4>`
+///
+/// Unary predicate function object that compares `projection::norm{}(value)`
+/// with one, avoiding the square root required to compute the magnitude.
+/// Non-finite magnitudes do not satisfy the predicate.
+///
+/// ~~~{.cpp}
+/// unit_norm<>{}(std::complex{0.6, 0.8});          // true
+/// unit_norm<>{}(std::array{0.0, 0.0, 1.0 + 1e-9}); // false
+/// ~~~
+///
+template <auto tol = constant::ulp<4>>
+struct unit_norm
+{
+  template <
+      typename T,
+      typename R = std::remove_cvref_t<
+          std::invoke_result_t<projection::norm, const T&>>>
+    requires std::floating_point<R>
+  constexpr auto operator()(const T& value) const
+      noexcept(std::is_nothrow_invocable_v<projection::norm, const T&>) -> bool
+  {
+    constexpr auto lower = R{1} - tol;
+    constexpr auto upper = R{1} + tol;
+
+    const auto n = projection::norm{}(value);
+    return (lower <= n) and (n <= upper);
+  }
+};
+
+/// Checks if a range of values is a probability vector
+/// @tparam tol tolerance of the sum, e.g. `constant::ulp<4>`
+///
+/// Unary predicate function object that checks that each value of a
+/// contiguous range of floating point values is nonnegative and that the sum
+/// of the values equals one within `tol`. Values are summed with pairwise
+/// summation in the same pass that checks their signs, without data-dependent
+/// branches. NaN values do not satisfy the predicate.
+///
+/// ~~~{.cpp}
+/// simplex<>{}(std::array{0.25, 0.75});      // true
+/// simplex<>{}(std::array{0.5, 0.75, -0.25}); // false
+/// ~~~
+///
+template <auto tol = constant::ulp<4>>
+struct simplex
+{
+  template <
+      std::ranges::contiguous_range R,
+      typename T = std::ranges::range_value_t<R>>
+    requires std::floating_point<T>
+  constexpr auto operator()(const R& values) const noexcept -> bool
+  {
+    constexpr auto lower = T{1} - tol;
+    constexpr auto upper = T{1} + tol;
+
+    const auto view =
+        std::span{std::ranges::data(values), std::ranges::size(values)};
+
+    auto invalid = 0U;
+    const auto sum = detail::pairwise_sum(view, invalid);
+
+    return (invalid == 0U) and (lower <= sum) and (sum <= upper);
+  }
+};
+
 }  // namespace predicate
 
 }  // namespace constrained_value
@@ -0,0 +1,393 @@
+#pragma once
+
+#include "src/detail/wrapping_cast.hpp"
+#include "src/source_location.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/// Per call site profiling of invariant checks
+///
+/// Enabled by defining `CONSTRAINED_VALUE_PROFILE`. When enabled, each check
+/// performed by `assert_predicate` is recorded against the source location of
+/// the call constructing or assigning the constrained value. Counts are
+/// aggregated in thread-local tables and a report sorted by total cycles is
+/// written to `std::cerr` at exit.
+///
+/// Each thread that performs a check allocates a thread-local table of about
+/// 48 KiB with room for 1024 call sites. Checks at further call sites are
+/// counted in a single entry.
+///
+/// `CONSTRAINED_VALUE_PROFILE` changes the definition of `assert_predicate`
+/// and of every inline function that checks an invariant. It must be defined
+/// for every translation unit of a program, or for none of them; otherwise the
+/// program violates the one definition rule and an arbitrary definition is
+/// used by the linker.
+///
+namespace constrained_value::profile {
+
+/// Returns a timestamp in processor cycles, or in steady clock ticks if a
+///     cycle counter is not available
+///
+[[nodiscard]] inline auto timestamp() noexcept -> std::uint64_t
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return static_cast<std::uint64_t>(
+      std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/// Source location of an invariant check
+///
+struct call_site
+{
+  std::string_view file;
+  std::string_view function;
+  std::uint_least32_t line;
+  std::uint_least32_t column;
+
+  [[nodiscard]] friend auto
+  operator==(const call_site&, const call_site&) -> bool = default;
+};
+
+/// Aggregated invariant checks for a call site
+///
+struct counters
+{
+  std::uint64_t checks;
+  std::uint64_t failures;
+  std::uint64_t cycles;
+
+  constexpr auto operator+=(const counters& other) noexcept -> counters&
+  {
+    checks += other.checks;
+    failures += other.failures;
+    cycles += other.cycles;
+    return *this;
+  }
+};
+
+/// Profile entry for a call site
+///
+struct entry
+{
+  call_site site;
+  counters count;
+};
+
+namespace detail {
+
+struct call_site_hash
+{
+  [[nodiscard]] auto operator()(const call_site& site) const noexcept
+      -> std::size_t
+  {
+    const auto h = std::hash<std::string_view>{};
+    auto seed = h(site.file);
+    seed ^= h(site.function) + (seed << 6U) + (seed >> 2U);
+    seed ^= (std::size_t{site.line} << 16U) ^ std::size_t{site.column};
+    return seed;
+  }
+};
+
+using counters_map = std::unordered_map<call_site, counters, call_site_hash>;
+
+// Counters of a call site. The key is written once by the owning thread
+// before `file` is published with release semantics. The counters are only
+// written by the owning thread and may be read concurrently when reporting.
+struct slot
+{
+  std::atomic<const char*> file;
+  const char* function;
+  std::uint_least32_t line;
+  std::uint_least32_t column;
+  std::atomic<std::uint64_t> checks;
+  std::atomic<std::uint64_t> failures;
+  std::atomic<std::uint64_t> cycles;
+
+  // Only called by the owning thread, so a read-modify-write is not required
+  static auto add(std::atomic<std::uint64_t>& c, std::uint64_t n) noexcept
+      -> void
+  {
+    c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  auto add(const counters& count) noexcept -> void
+  {
+    add(checks, count.checks);
+    add(failures, count.failures);
+    add(cycles, count.cycles);
+  }
+};
+
+// Fixed capacity, open addressing hash table of the call sites checked by a
+// thread. Call sites are identified by the addresses of their file and
+// function names, so recording a check neither locks, hashes strings, nor
+// allocates. Call sites are merged by name when a report is generated.
+//
+// Checks at call sites that do not fit in the table are recorded against a
+// single overflow entry.
+class table
+{
+  static constexpr auto capacity = std::size_t{1024};
+
+  std::array<slot, capacity> slots_{};
+  slot overflow_{};
+
+  // Only written before the table is published and by `registry::detach`
+  friend class registry;
+  table* next_{};
+
+  static auto publish(slot& s, const source_location& sl) noexcept -> void
+  {
+    s.function = sl.function_name();
+    s.line = sl.line();
+    s.column = sl.column();
+    s.file.store(sl.file_name(), std::memory_order_release);
+  }
+
+  [[nodiscard]] auto find(const source_location& sl) noexcept -> slot&
+  {
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto index = ::constrained_value::detail::wrapping_cast<std::size_t>(
+        reinterpret_cast<std::uintptr_t>(sl.file_name()) ^
+        reinterpret_cast<std::uintptr_t>(sl.function_name()) ^
+        (std::uintptr_t{sl.line()} * 0x9E3779B9U) ^
+        std::uintptr_t{sl.column()});
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    for (auto probe = std::size_t{}; probe != capacity; ++probe) {
+      auto& s = slots_[index % capacity];
+      const auto* file = s.file.load(std::memory_order_relaxed);
+
+      if (file == nullptr) {
+        publish(s, sl);
+        return s;
+      }
+      if (file == sl.file_name() and s.function == sl.function_name() and
+          s.line == sl.line() and s.column == sl.column()) {
+        return s;
+      }
+      ++index;
+    }
+    return overflow_;
+  }
+
+public:
+  table() noexcept
+  {
+    overflow_.function = "";
+    overflow_.file.store("(untracked call sites)", std::memory_order_release);
+  }
+
+  auto add(const source_location& sl, const counters& count) noexcept -> void
+  {
+    find(sl).add(count);
+  }
+
+  auto merge_into(counters_map& other) const -> void
+  {
+    const auto merge = [&other](const slot& s) {
+      const auto* file = s.file.load(std::memory_order_acquire);
+      if (file == nullptr) {
+        return;
+      }
+
+      const auto count = counters{
+          s.checks.load(std::memory_order_relaxed),
+          s.failures.load(std::memory_order_relaxed),
+          s.cycles.load(std::memory_order_relaxed)};
+      if (count.checks != 0) {
+        other[{file, s.function, s.line, s.column}] += count;
+      }
+    };
+
+    std::ranges::for_each(slots_, merge);
+    merge(overflow_);
+  }
+};
+
+inline auto write_report(std::ostream& os, const std::vector<entry>& entries)
+    -> void
+{
+  os << "constrained_value profile: checks failures cycles cycles/check "
+        "call-site\n";
+
+  for (const auto& [site, count] : entries) {
+    os << count.checks << ' ' << count.failures << ' ' << count.cycles << ' '
+       << (count.cycles / std::max(count.checks, std::uint64_t{1})) << ' '
+       << site.file << '(' << site.line << ':' << site.column << ") `"
+       << site.function << "`\n";
+  }
+}
+
+// Owns the tables of live threads and the merged counts of exited threads.
+//
+// Tables are pushed onto a lock-free list so that registering a thread does
+// not lock or throw. Tables are only unlinked and traversed while holding the
+// mutex. Unlinking only modifies the head with a compare-and-swap, which
+// fails if a concurrent push modified it.
+//
+// The registry is never destroyed, so threads may record checks during
+// static destruction. A report is written at exit by a handler registered
+// with `std::atexit`.
+class registry
+{
+  std::atomic<table*> live_{};
+  std::mutex mutex_;
+  std::optional<counters_map> retired_;
+
+  static auto report_at_exit() noexcept -> void;
+
+public:
+  registry() noexcept { static_cast<void>(std::atexit(&report_at_exit)); }
+  registry(const registry&) = delete;
+  registry(registry&&) = delete;
+  auto operator=(const registry&) -> registry& = delete;
+  auto operator=(registry&&) -> registry& = delete;
+  ~registry() = default;
+
+  auto attach(table& t) noexcept -> void
+  {
+    t.next_ = live_.load(std::memory_order_relaxed);
+    while (not live_.compare_exchange_weak(
+        t.next_, &t, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+  }
+
+  auto detach(table& t) -> void
+  {
+    const auto lock = std::lock_guard{mutex_};
+
+    auto* head = &t;
+    if (not live_.compare_exchange_strong(
+            head, t.next_, std::memory_order_acq_rel)) {
+      auto* prev = head;
+      while (prev->next_ != &t) {
+        prev = prev->next_;
+      }
+      prev->next_ = t.next_;
+    }
+
+    if (not retired_) {
+      retired_.emplace();
+    }
+    t.merge_into(*retired_);
+  }
+
+  [[nodiscard]] auto snapshot() -> std::vector<entry>
+  {
+    auto merged = counters_map{};
+    {
+      const auto lock = std::lock_guard{mutex_};
+      if (retired_) {
+        merged = *retired_;
+      }
+      for (const auto* t = live_.load(std::memory_order_acquire); t != nullptr;
+           t = t->next_) {
+        t->merge_into(merged);
+      }
+    }
+
+    auto entries = std::vector<entry>{};
+    entries.reserve(merged.size());
+    for (const auto& [site, count] : merged) {
+      entries.push_back({site, count});
+    }
+
+    std::ranges::sort(entries, std::ranges::greater{}, [](const entry& e) {
+      return e.count.cycles;
+    });
+
+    return entries;
+  }
+};
+
+// Constructed in static storage on first use and never destroyed
+[[nodiscard]] inline auto global_registry() noexcept -> registry&
+{
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  alignas(registry) static std::byte storage[sizeof(registry)];
+  static auto* const r = ::new (static_cast<void*>(storage)) registry{};
+  return *r;
+}
+
+inline auto registry::report_at_exit() noexcept -> void
+{
+  try {
+    write_report(std::cerr, global_registry().snapshot());
+  } catch (...) {
+    // a report is not written if it cannot be allocated
+  }
+}
+
+class thread_table
+{
+  table table_;
+
+public:
+  thread_table() noexcept { global_registry().attach(table_); }
+  thread_table(const thread_table&) = delete;
+  thread_table(thread_table&&) = delete;
+  auto operator=(const thread_table&) -> thread_table& = delete;
+  auto operator=(thread_table&&) -> thread_table& = delete;
+  ~thread_table() { global_registry().detach(table_); }
+
+  [[nodiscard]] auto get() noexcept -> table& { return table_; }
+};
+
+}  // namespace detail
+
+/// Records an invariant check
+/// @param sl source location of the check
+/// @param satisfied result of evaluating the invariant predicate
+/// @param cycles duration of the check
+///
+/// Does not lock, allocate, or throw. The first check of a thread registers
+/// the thread-local table of the thread, which occupies about 48 KiB.
+///
+inline auto
+record(const source_location& sl, bool satisfied, std::uint64_t cycles)
+    -> void
+{
+  thread_local auto local = detail::thread_table{};
+
+  local.get().add(sl, {1, satisfied ? 0U : 1U, cycles});
+}
+
+/// Returns the aggregated checks of all threads, sorted by total cycles in
+///     descending order
+///
+[[nodiscard]] inline auto snapshot() -> std::vector<entry>
+{
+  return detail::global_registry().snapshot();
+}
+
+/// Writes a report of the aggregated checks of all threads
+///
+inline auto report(std::ostream& os) -> void
+{
+  detail::write_report(os, snapshot());
+}
+
+}  // namespace constrained_value::profile
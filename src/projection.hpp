@@ -3,6 +3,9 @@
 #include "src/detail/priority.hpp"
 
 #include <concepts>
+#include <ranges>
+#include <type_traits>
+#include <utility>
 
 namespace constrained_value::projection {
 namespace detail {
@@ -53,8 +56,84 @@ public:
   }
 };
 
+class norm_fn
+{
+  template <int N>
+  using priority = ::constrained_value::detail::priority<N>;
+
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  static constexpr auto impl(priority<2>, T value) noexcept
+  {
+    return value * value;
+  }
+
+  template <typename T>
+  static constexpr auto
+  impl(priority<1>, const T& value) noexcept(noexcept(norm(value)))
+      -> decltype(norm(value))
+  {
+    return norm(value);
+  }
+
+  template <std::ranges::input_range T>
+  static constexpr auto impl(priority<0>, const T& value)
+      -> std::remove_cvref_t<decltype(impl(
+          priority<2>{}, *std::ranges::begin(value)))>
+  {
+    auto sum = std::remove_cvref_t<decltype(impl(
+        priority<2>{}, *std::ranges::begin(value)))>{};
+    for (const auto& element : value) {
+      sum += impl(priority<2>{}, element);
+    }
+    return sum;
+  }
+
+public:
+  template <typename T>
+  constexpr auto operator()(const T& value) const
+      -> decltype(impl(priority<2>{}, value))
+  {
+    return impl(priority<2>{}, value);
+  }
+};
+
+class size_fn
+{
+public:
+  template <std::ranges::sized_range T>
+  constexpr auto operator()(const T& value) const
+      noexcept(noexcept(std::ranges::size(value)))
+      -> decltype(std::ranges::size(value))
+  {
+    return std::ranges::size(value);
+  }
+};
+
 }  // namespace detail
 
 using abs = detail::abs_fn;
 
+/// Computes the squared magnitude of a value
+///
+/// Squares arithmetic values, invokes `norm` found by argument-dependent
+/// lookup (e.g. for `std::complex`), and sums the squared magnitudes of the
+/// elements of a range. No square root is computed.
+///
+/// ~~~{.cpp}
+/// norm{}(-3.0);                            // 9.0
+/// norm{}(std::complex{3.0, 4.0});          // 25.0
+/// norm{}(std::array{1.0, 2.0, 2.0});       // 9.0
+/// ~~~
+///
+using norm = detail::norm_fn;
+
+/// Computes the number of elements in a range
+///
+/// ~~~{.cpp}
+/// size{}(std::string_view{"abc"}); // 3
+/// ~~~
+///
+using size = detail::size_fn;
+
 }  // namespace constrained_value::projection
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "src/assert_predicate.hpp"
+#include "src/bounds.hpp"
+#include "src/constrained_value.hpp"
+#include "src/detail/validate.hpp"
+#include "src/source_location.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+
+namespace constrained_value {
+
+/// A bounded floating point value stored as a fixed-point code
+/// @tparam CV `constrained_value` type with floating point underlying type and
+///     inclusive bounds
+/// @tparam Code unsigned integer type used to store a value
+/// @tparam bits number of bits of `Code` used, determining the resolution
+///
+/// Maps the interval `[lower, upper]` of `CV` uniformly onto the codes
+/// `[0, 2^bits - 1]`. Values are validated with the invariant of `CV` and
+/// rounded to the nearest code on write, and converted to the underlying type
+/// on read. The lower and upper bounds are represented exactly.
+///
+/// ~~~{.cpp}
+/// using gain = quantized<bounded<float, 0, 1>>;  // 2 bytes
+///
+/// auto g = gain{0.5F};
+/// float x = g;  // 0.5F +/- gain::resolution / 2
+/// ~~~
+///
+/// @note NaN satisfies the invariant of `bounded` and is stored as the lower
+///     bound.
+///
+template <
+    typename CV,
+    std::unsigned_integral Code = std::uint16_t,
+    int bits = std::numeric_limits<Code>::digits>
+  requires (
+      bounded_value<CV> and
+      std::floating_point<typename CV::underlying_type> and (bits > 0) and
+      (bits <= std::numeric_limits<Code>::digits) and
+      (bits <= std::numeric_limits<typename CV::underlying_type>::digits))
+class quantized
+{
+  using T = typename CV::underlying_type;
+  using P = typename CV::predicate_type;
+  using V = typename CV::violation_policy_type;
+
+  static constexpr auto max_code =
+      static_cast<Code>(std::numeric_limits<Code>::max() >>
+                        (std::numeric_limits<Code>::digits - bits));
+
+  static constexpr auto lower = T{bounds_of<P>::lower};
+  static constexpr auto upper = T{bounds_of<P>::upper};
+  static constexpr auto max_value = T{max_code};
+  static constexpr auto scale = max_value / (upper - lower);
+
+  Code code_;
+
+  // Written without branches or calls to `<cmath>` so that loops over values
+  // may be vectorized. Comparisons map NaN to the lower bound.
+  static constexpr auto encode(T value) noexcept -> Code
+  {
+    auto x = (value - lower) * scale + T{0.5};
+    x = (x > T{}) ? x : T{};
+    x = (x < max_value) ? x : max_value;
+    return static_cast<Code>(x);
+  }
+
+  static constexpr auto decode(Code code) noexcept -> T
+  {
+    const auto x = std::min(lower + static_cast<T>(code) * resolution, upper);
+    return (code == max_code) ? upper : x;
+  }
+
+public:
+  /// Underlying type
+  ///
+  using underlying_type = T;
+
+  /// Predicate type
+  ///
+  using predicate_type = P;
+
+  /// Violation policy type
+  ///
+  using violation_policy_type = V;
+
+  /// Code type
+  ///
+  using code_type = Code;
+
+  /// Difference between the values of adjacent codes
+  ///
+  static constexpr auto resolution = (upper - lower) / max_value;
+
+  /// Default construct a quantized value
+  /// @pre `T{}` satisfies `P`
+  ///
+  constexpr quantized(source_location sl = source_location::current())
+      : code_{(assert_predicate<P, V>(T{}, __PRETTY_FUNCTION__, sl),
+               encode(T{}))}
+  {}
+
+  /// Construct a quantized value
+  /// @tparam U underlying type `T`
+  /// @param value `value` of underlying type
+  /// @pre value satisfies `P`
+  ///
+  template <std::same_as<T> U>
+  constexpr quantized(U value, source_location sl = source_location::current())
+      : code_{(assert_predicate<P, V>(value, __PRETTY_FUNCTION__, sl),
+               encode(value))}
+  {}
+
+  /// Construct a quantized value from a constrained value
+  ///
+  constexpr quantized(const CV& value) noexcept : code_{encode(value.value())}
+  {}
+
+  /// Returns the value represented by the code
+  ///
+  [[nodiscard]] constexpr auto value() const noexcept -> T
+  {
+    return decode(code_);
+  }
+
+  /// Implicit conversion to the underlying type
+  ///
+  [[nodiscard]] constexpr operator T() const noexcept { return value(); }
+
+  /// Implicit conversion to the constrained value
+  ///
+  [[nodiscard]] constexpr operator CV() const noexcept
+  {
+    return CV{unchecked, value()};
+  }
+
+  /// Returns the stored code
+  ///
+  [[nodiscard]] constexpr auto code() const noexcept -> Code { return code_; }
+
+  /// Encodes values of the underlying type
+  /// @param values values to encode
+  /// @param out destination with at least `values.size()` elements
+  /// @pre each value satisfies `P`
+  ///
+  /// Values are validated in bulk before any value is encoded. If the
+  /// violation policy returns, `out` is not modified.
+  ///
+  static auto encode_all(
+      std::span<const T> values,
+      std::span<quantized> out,
+      source_location sl = source_location::current()) -> void
+  {
+    assert(out.size() >= values.size());
+
+    if (not detail::validate_each<P, V>(
+            values.data(), values.size(), __PRETTY_FUNCTION__, sl)) {
+      return;
+    }
+
+    for (auto i = std::size_t{}; i != values.size(); ++i) {
+      out[i].code_ = encode(values[i]);
+    }
+  }
+
+  /// Decodes quantized values to the underlying type
+  /// @param values values to decode
+  /// @param out destination with at least `values.size()` elements
+  ///
+  static auto decode_all(
+      std::span<const quantized> values, std::span<T> out) noexcept -> void
+  {
+    assert(out.size() >= values.size());
+
+    for (auto i = std::size_t{}; i != values.size(); ++i) {
+      out[i] = decode(values[i].code_);
+    }
+  }
+
+  /// Comparison operators
+  ///
+  /// Codes preserve the order of values and are compared without decoding.
+  ///
+  /// @{
+  [[nodiscard]] friend constexpr auto
+  operator==(const quantized&, const quantized&) noexcept -> bool = default;
+
+  [[nodiscard]] friend constexpr auto
+  operator<=>(const quantized& x, const quantized& y) noexcept
+  {
+    return x.code_ <=> y.code_;
+  }
+  /// @}
+};
+
+}  // namespace constrained_value
@@ -0,0 +1,751 @@
+#pragma once
+
+#include "src/fixed_string.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace constrained_value {
+namespace detail::regex {
+
+// Not defined and not `constexpr`. Invoking this function during constant
+// evaluation results in a compile error that names the failure.
+auto pattern_syntax_error() -> void;
+auto pattern_too_complex() -> void;
+
+inline constexpr auto max_nfa_states = std::size_t{512};
+inline constexpr auto max_dfa_states = std::size_t{256};
+inline constexpr auto max_classes = std::size_t{64};
+inline constexpr auto none = std::numeric_limits<std::size_t>::max();
+
+template <std::size_t N>
+class bitset
+{
+  std::array<std::uint64_t, (N + 63) / 64> words_;
+
+public:
+  constexpr bitset() noexcept : words_{} {}
+
+  constexpr auto insert(std::size_t i) noexcept -> void
+  {
+    words_[i / 64] |= std::uint64_t{1} << (i % 64);
+  }
+
+  [[nodiscard]] constexpr auto contains(std::size_t i) const noexcept -> bool
+  {
+    return ((words_[i / 64] >> (i % 64)) & 1U) != 0;
+  }
+
+  constexpr auto operator|=(const bitset& other) noexcept -> bitset&
+  {
+    for (auto i = std::size_t{}; i != words_.size(); ++i) {
+      words_[i] |= other.words_[i];
+    }
+    return *this;
+  }
+
+  // Invokes `f` with the index of each element
+  template <typename F>
+  constexpr auto for_each(F f) const -> void
+  {
+    for (auto i = std::size_t{}; i != words_.size(); ++i) {
+      for (auto bits = words_[i]; bits != 0; bits &= bits - 1) {
+        f((i * 64) + static_cast<std::size_t>(std::countr_zero(bits)));
+      }
+    }
+  }
+
+  [[nodiscard]] constexpr auto hash() const noexcept -> std::uint64_t
+  {
+    auto h = std::uint64_t{};
+    for (const auto word : words_) {
+      h = (h ^ word) * std::uint64_t{0x100000001b3};
+    }
+    return h;
+  }
+
+  [[nodiscard]] constexpr auto complement() const noexcept -> bitset
+  {
+    auto result = bitset{};
+    for (auto i = std::size_t{}; i != words_.size(); ++i) {
+      result.words_[i] = ~words_[i];
+    }
+    return result;
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator==(const bitset&, const bitset&) -> bool = default;
+};
+
+using charset = bitset<256>;
+
+[[nodiscard]] constexpr auto to_byte(char c) noexcept -> std::size_t
+{
+  return static_cast<unsigned char>(c);
+}
+
+// A state of a Thompson NFA with at most one labelled edge and at most two
+// epsilon edges
+struct nfa_state
+{
+  charset label;
+  std::size_t next{none};
+  std::array<std::size_t, 2> epsilon{none, none};
+};
+
+// Sub-automaton with a single start and a single accepting state. The
+// accepting state has no outgoing edges.
+struct fragment
+{
+  std::size_t start;
+  std::size_t accept;
+};
+
+struct nfa
+{
+  std::array<nfa_state, max_nfa_states> states{};
+  std::size_t size{};
+  std::size_t start{};
+  std::size_t accept{};
+};
+
+// Recursive descent parser that constructs an NFA. Supports literals, `.`,
+// bracket expressions, the escapes `\d \D \w \W \s \S \n \r \t \f \v` and
+// escaped metacharacters `^ $ \ . * + ? ( ) [ ] { } | / -`, grouping,
+// alternation, and the quantifiers `*`, `+`, `?`, `{m}`, `{m,}` and `{m,n}`.
+class parser
+{
+  std::string_view pattern_;
+  std::size_t pos_{};
+  nfa nfa_{};
+
+  [[nodiscard]] constexpr auto done() const noexcept -> bool
+  {
+    return pos_ == pattern_.size();
+  }
+
+  [[nodiscard]] constexpr auto peek() const noexcept -> char
+  {
+    return done() ? '\0' : pattern_[pos_];
+  }
+
+  constexpr auto next() -> char
+  {
+    if (done()) {
+      pattern_syntax_error();
+    }
+    return pattern_[pos_++];
+  }
+
+  constexpr auto expect(char c) -> void
+  {
+    if (next() != c) {
+      pattern_syntax_error();
+    }
+  }
+
+  constexpr auto add_state() -> std::size_t
+  {
+    if (nfa_.size == max_nfa_states) {
+      pattern_too_complex();
+    }
+    // Assigned explicitly as GCC may share the initializer of the elements
+    // of `nfa::states` between constant evaluations.
+    nfa_.states[nfa_.size] = nfa_state{};
+    return nfa_.size++;
+  }
+
+  constexpr auto add_epsilon(std::size_t from, std::size_t to) -> void
+  {
+    auto& epsilon = nfa_.states[from].epsilon;
+    (epsilon[0] == none ? epsilon[0] : epsilon[1]) = to;
+  }
+
+  constexpr auto empty() -> fragment
+  {
+    const auto s = add_state();
+    return {s, s};
+  }
+
+  constexpr auto labelled(const charset& label) -> fragment
+  {
+    const auto s = add_state();
+    const auto e = add_state();
+    nfa_.states[s].label = label;
+    nfa_.states[s].next = e;
+    return {s, e};
+  }
+
+  constexpr auto concatenate(fragment a, fragment b) -> fragment
+  {
+    add_epsilon(a.accept, b.start);
+    return {a.start, b.accept};
+  }
+
+  constexpr auto alternate(fragment a, fragment b) -> fragment
+  {
+    const auto s = add_state();
+    const auto e = add_state();
+    add_epsilon(s, a.start);
+    add_epsilon(s, b.start);
+    add_epsilon(a.accept, e);
+    add_epsilon(b.accept, e);
+    return {s, e};
+  }
+
+  constexpr auto star(fragment a) -> fragment
+  {
+    const auto s = add_state();
+    const auto e = add_state();
+    add_epsilon(s, a.start);
+    add_epsilon(s, e);
+    add_epsilon(a.accept, a.start);
+    add_epsilon(a.accept, e);
+    return {s, e};
+  }
+
+  constexpr auto plus(fragment a) -> fragment
+  {
+    const auto e = add_state();
+    add_epsilon(a.accept, a.start);
+    add_epsilon(a.accept, e);
+    return {a.start, e};
+  }
+
+  constexpr auto optional(fragment a) -> fragment
+  {
+    const auto s = add_state();
+    const auto e = add_state();
+    add_epsilon(s, a.start);
+    add_epsilon(s, e);
+    add_epsilon(a.accept, e);
+    return {s, e};
+  }
+
+  // Returns the set of characters matched by an escape sequence. Sets `c` to
+  // the escaped character if the sequence matches a single character.
+  constexpr auto escape(char& c) -> charset
+  {
+    auto set = charset{};
+    const auto insert_range = [&set](char lo, char hi) {
+      for (auto i = to_byte(lo); i <= to_byte(hi); ++i) {
+        set.insert(i);
+      }
+    };
+
+    c = next();
+    switch (c) {
+      case 'd':
+      case 'D':
+        insert_range('0', '9');
+        break;
+      case 'w':
+      case 'W':
+        insert_range('0', '9');
+        insert_range('A', 'Z');
+        insert_range('a', 'z');
+        set.insert(to_byte('_'));
+        break;
+      case 's':
+      case 'S':
+        insert_range('\t', '\r');
+        set.insert(to_byte(' '));
+        break;
+      case 'n':
+        c = '\n';
+        break;
+      case 'r':
+        c = '\r';
+        break;
+      case 't':
+        c = '\t';
+        break;
+      case 'f':
+        c = '\f';
+        break;
+      case 'v':
+        c = '\v';
+        break;
+      default:
+        if (std::string_view{"^$\\.*+?()[]{}|/-"}.find(c) ==
+            std::string_view::npos) {
+          pattern_syntax_error();
+        }
+        break;
+    }
+
+    switch (c) {
+      case 'd':
+      case 'w':
+      case 's':
+        c = '\0';
+        return set;
+      case 'D':
+      case 'W':
+      case 'S':
+        c = '\0';
+        return set.complement();
+      default:
+        set.insert(to_byte(c));
+        return set;
+    }
+  }
+
+  constexpr auto bracket() -> charset
+  {
+    const auto negate = (peek() == '^');
+    if (negate) {
+      ++pos_;
+    }
+
+    // an empty class, `[]` or `[^]` in ECMAScript, is not supported. A
+    // leading `]` is rejected instead of being treated as a literal as in
+    // POSIX.
+    if (peek() == ']') {
+      pattern_syntax_error();
+    }
+
+    auto set = charset{};
+
+    while (peek() != ']') {
+      auto lo = next();
+      if (lo == '\\') {
+        const auto escaped = escape(lo);
+        if (lo == '\0') {
+          set |= escaped;
+          continue;
+        }
+      }
+
+      auto hi = lo;
+      if (peek() == '-' and pos_ + 1 < pattern_.size() and
+          pattern_[pos_ + 1] != ']') {
+        ++pos_;
+        hi = next();
+        if (hi == '\\') {
+          static_cast<void>(escape(hi));
+          if (hi == '\0') {
+            pattern_syntax_error();
+          }
+        }
+      }
+
+      if (to_byte(hi) < to_byte(lo)) {
+        pattern_syntax_error();
+      }
+      for (auto i = to_byte(lo); i <= to_byte(hi); ++i) {
+        set.insert(i);
+      }
+    }
+    expect(']');
+
+    return negate ? set.complement() : set;
+  }
+
+  // NOLINTNEXTLINE(misc-no-recursion)
+  constexpr auto atom() -> fragment
+  {
+    auto c = next();
+    switch (c) {
+      case '(': {
+        const auto f = (peek() == ')') ? empty() : alternation();
+        expect(')');
+        return f;
+      }
+      case '[':
+        return labelled(bracket());
+      case '.': {
+        auto newline = charset{};
+        newline.insert(to_byte('\n'));
+        return labelled(newline.complement());
+      }
+      case '\\':
+        return labelled(escape(c));
+      case ')':
+      case '|':
+      case '*':
+      case '+':
+      case '?':
+      case '{':
+        pattern_syntax_error();
+        return {};
+      default: {
+        auto set = charset{};
+        set.insert(to_byte(c));
+        return labelled(set);
+      }
+    }
+  }
+
+  constexpr auto count() -> std::size_t
+  {
+    auto n = std::size_t{};
+    if (peek() < '0' or peek() > '9') {
+      pattern_syntax_error();
+    }
+    while (peek() >= '0' and peek() <= '9') {
+      n = (n * 10) + static_cast<std::size_t>(next() - '0');
+      if (n > max_nfa_states) {
+        pattern_too_complex();
+      }
+    }
+    return n;
+  }
+
+  // Constructs another copy of the quantified expression in [first, last)
+  // NOLINTNEXTLINE(misc-no-recursion)
+  constexpr auto copy(std::size_t first, std::size_t last) -> fragment
+  {
+    const auto pos = pos_;
+
+    pos_ = first;
+    auto f = atom();
+    while (pos_ != last) {
+      f = quantify(f, first);
+    }
+
+    pos_ = pos;
+    return f;
+  }
+
+  // Applies the quantifier at the current position to `f`, the expression
+  // beginning at `first`
+  // NOLINTNEXTLINE(misc-no-recursion)
+  constexpr auto quantify(fragment f, std::size_t first) -> fragment
+  {
+    const auto quantifier = pos_;
+
+    switch (next()) {
+      case '*':
+        return star(f);
+      case '+':
+        return plus(f);
+      case '?':
+        return optional(f);
+      default:
+        break;
+    }
+
+    const auto min = count();
+    auto max = min;
+    auto unbounded = false;
+
+    if (peek() == ',') {
+      ++pos_;
+      unbounded = (peek() == '}');
+      if (not unbounded) {
+        max = count();
+      }
+    }
+    expect('}');
+
+    if (max < min) {
+      pattern_syntax_error();
+    }
+
+    auto next_copy = [&, copies = std::size_t{}]() mutable {
+      return (copies++ == 0) ? f : copy(first, quantifier);
+    };
+
+    auto result = empty();
+    for (auto i = std::size_t{}; i != min; ++i) {
+      result = concatenate(result, next_copy());
+    }
+    if (unbounded) {
+      result = concatenate(result, star(next_copy()));
+    }
+    for (auto i = min; i != max; ++i) {
+      result = concatenate(result, optional(next_copy()));
+    }
+    return result;
+  }
+
+  [[nodiscard]] static constexpr auto is_quantifier(char c) noexcept -> bool
+  {
+    return c == '*' or c == '+' or c == '?' or c == '{';
+  }
+
+  // NOLINTNEXTLINE(misc-no-recursion)
+  constexpr auto repetition() -> fragment
+  {
+    const auto first = pos_;
+
+    auto f = atom();
+    while (is_quantifier(peek())) {
+      f = quantify(f, first);
+    }
+    return f;
+  }
+
+  // NOLINTNEXTLINE(misc-no-recursion)
+  constexpr auto concatenation() -> fragment
+  {
+    auto f = empty();
+    while (not done() and peek() != '|' and peek() != ')') {
+      f = concatenate(f, repetition());
+    }
+    return f;
+  }
+
+  // NOLINTNEXTLINE(misc-no-recursion)
+  constexpr auto alternation() -> fragment
+  {
+    auto f = concatenation();
+    while (peek() == '|') {
+      ++pos_;
+      f = alternate(f, concatenation());
+    }
+    return f;
+  }
+
+public:
+  constexpr explicit parser(std::string_view pattern) : pattern_{pattern} {}
+
+  [[nodiscard]] constexpr auto parse() && -> nfa
+  {
+    const auto f = alternation();
+    if (not done()) {
+      pattern_syntax_error();
+    }
+
+    nfa_.start = f.start;
+    nfa_.accept = f.accept;
+    return nfa_;
+  }
+};
+
+using nfa_set = bitset<max_nfa_states>;
+
+// Deterministic automaton over character classes, where all characters in a
+// class have transitions to the same states. State 0 rejects all input and
+// state 1 is the start state.
+struct dfa_builder
+{
+  std::array<std::uint8_t, 256> class_of{};
+  std::size_t classes{};
+  std::size_t states{};
+  std::array<std::uint16_t, max_dfa_states * max_classes> next{};
+  nfa_set accepting{};
+};
+
+// Partitions characters into classes that no edge label distinguishes
+[[nodiscard]] constexpr auto
+partition(const nfa& automaton, dfa_builder& dfa) -> std::array<char, 256>
+{
+  auto labels = std::array<charset, max_nfa_states>{};
+  auto label_count = std::size_t{};
+
+  for (auto s = std::size_t{}; s != automaton.size; ++s) {
+    const auto& state = automaton.states[s];
+    if (state.next == none) {
+      continue;
+    }
+
+    auto seen = false;
+    for (auto i = std::size_t{}; i != label_count and not seen; ++i) {
+      seen = (labels[i] == state.label);
+    }
+    if (not seen) {
+      labels[label_count++] = state.label;
+    }
+  }
+
+  auto representative = std::array<char, 256>{};
+  dfa.classes = 0;
+
+  for (auto c = std::size_t{}; c != 256; ++c) {
+    auto k = std::size_t{};
+    for (; k != dfa.classes; ++k) {
+      const auto r = to_byte(representative[k]);
+
+      auto same = true;
+      for (auto i = std::size_t{}; i != label_count and same; ++i) {
+        same = (labels[i].contains(c) == labels[i].contains(r));
+      }
+      if (same) {
+        break;
+      }
+    }
+
+    if (k == dfa.classes) {
+      if (dfa.classes == max_classes) {
+        pattern_too_complex();
+      }
+      representative[dfa.classes++] = static_cast<char>(c);
+    }
+    dfa.class_of[c] = static_cast<std::uint8_t>(k);
+  }
+
+  return representative;
+}
+
+constexpr auto epsilon_closure(const nfa& automaton, nfa_set& set) -> void
+{
+  auto stack = std::array<std::size_t, max_nfa_states>{};
+  auto top = std::size_t{};
+
+  set.for_each([&stack, &top](std::size_t s) { stack[top++] = s; });
+
+  while (top != 0) {
+    const auto s = stack[--top];
+    for (const auto t : automaton.states[s].epsilon) {
+      if (t != none and not set.contains(t)) {
+        set.insert(t);
+        stack[top++] = t;
+      }
+    }
+  }
+}
+
+// Constructs a DFA with the subset construction
+[[nodiscard]] constexpr auto determinize(const nfa& automaton) -> dfa_builder
+{
+  auto dfa = dfa_builder{};
+  const auto representative = partition(automaton, dfa);
+
+  auto sets = std::array<nfa_set, max_dfa_states>{};
+  auto hashes = std::array<std::uint64_t, max_dfa_states>{};
+
+  sets[1].insert(automaton.start);
+  epsilon_closure(automaton, sets[1]);
+  hashes[0] = sets[0].hash();
+  hashes[1] = sets[1].hash();
+  dfa.states = 2;
+
+  for (auto i = std::size_t{1}; i != dfa.states; ++i) {
+    if (sets[i].contains(automaton.accept)) {
+      dfa.accepting.insert(i);
+    }
+
+    for (auto k = std::size_t{}; k != dfa.classes; ++k) {
+      const auto c = to_byte(representative[k]);
+
+      auto target = nfa_set{};
+      sets[i].for_each([&automaton, &target, c](std::size_t s) {
+        const auto& state = automaton.states[s];
+        if (state.next != none and state.label.contains(c)) {
+          target.insert(state.next);
+        }
+      });
+      epsilon_closure(automaton, target);
+
+      const auto h = target.hash();
+      auto j = std::size_t{};
+      while (j != dfa.states and
+             (hashes[j] != h or not (sets[j] == target))) {
+        ++j;
+      }
+      if (j == dfa.states) {
+        if (dfa.states == max_dfa_states) {
+          pattern_too_complex();
+        }
+        hashes[dfa.states] = h;
+        sets[dfa.states++] = target;
+      }
+
+      dfa.next[(i * dfa.classes) + k] = static_cast<std::uint16_t>(j);
+    }
+  }
+
+  return dfa;
+}
+
+/// Table-driven DFA with `States` states over `Classes` character classes
+///
+template <std::size_t States, std::size_t Classes>
+struct dfa
+{
+  using state_type =
+      std::conditional_t<(States <= 256), std::uint8_t, std::uint16_t>;
+
+  std::array<std::uint8_t, 256> class_of{};
+  std::array<state_type, States * Classes> next{};
+  std::array<state_type, States> accepting{};
+
+  [[nodiscard]] constexpr auto match(std::string_view str) const noexcept
+      -> bool
+  {
+    auto state = std::size_t{1};
+    for (const auto c : str) {
+      state = next[(state * Classes) + class_of[to_byte(c)]];
+    }
+    return accepting[state] != 0;
+  }
+};
+
+template <fixed_string pattern>
+inline constexpr auto nfa_for = parser{pattern.view()}.parse();
+
+template <fixed_string pattern>
+inline constexpr auto dfa_builder_for = determinize(nfa_for<pattern>);
+
+template <fixed_string pattern>
+[[nodiscard]] consteval auto compile()
+{
+  constexpr const auto& builder = dfa_builder_for<pattern>;
+
+  auto result = dfa<builder.states, builder.classes>{};
+  using state_type = typename decltype(result)::state_type;
+
+  result.class_of = builder.class_of;
+  for (auto i = std::size_t{}; i != result.next.size(); ++i) {
+    result.next[i] = static_cast<state_type>(builder.next[i]);
+  }
+  for (auto i = std::size_t{}; i != builder.states; ++i) {
+    result.accepting[i] = builder.accepting.contains(i) ? 1 : 0;
+  }
+  return result;
+}
+
+template <fixed_string pattern>
+inline constexpr auto dfa_for = compile<pattern>();
+
+}  // namespace detail::regex
+
+namespace predicate {
+
+/// Checks if an entire string matches a regular expression
+/// @tparam pattern regular expression
+///
+/// Unary predicate function object that matches a string against `pattern`,
+/// compiled to a deterministic finite automaton at compile time. Matching
+/// performs one table lookup per character, without heap allocation or
+/// backtracking.
+///
+/// The pattern syntax is a subset of ECMAScript:
+/// - literal characters and `.`, matching any character except `'\n'`
+/// - bracket expressions, e.g. `[a-z_]` and `[^0-9]`. A `]` in a bracket
+///   expression must be escaped; the empty classes `[]` and `[^]` are not
+///   supported.
+/// - the escapes `\d \D \w \W \s \S \n \r \t \f \v` and the escaped
+///   metacharacters `^ $ \ . * + ? ( ) [ ] { } | / -`, e.g. `\.`. Other
+///   escapes, such as `\b`, `\x41` and `\1`, are syntax errors.
+/// - grouping `(...)` and alternation `|`
+/// - the quantifiers `*`, `+`, `?`, `{m}`, `{m,}` and `{m,n}`
+///
+/// Anchors, backreferences, and lazy quantifiers are not supported. An
+/// invalid pattern results in a compile error.
+///
+/// ~~~{.cpp}
+/// using identifier = constrained_value<
+///     std::string_view,
+///     predicate::matches<"[a-zA-Z_][a-zA-Z0-9_]*">>;
+/// ~~~
+///
+template <fixed_string pattern>
+struct matches
+{
+  [[nodiscard]] constexpr auto operator()(std::string_view str) const noexcept
+      -> bool
+  {
+    return detail::regex::dfa_for<pattern>.match(str);
+  }
+};
+
+}  // namespace predicate
+}  // namespace constrained_value
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "src/constant.hpp"
+#include "src/detail/pairwise_sum.hpp"
+#include "src/predicate.hpp"
+#include "src/projection.hpp"
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace constrained_value {
+namespace detail {
+
+template <typename T, typename R>
+constexpr auto scale(T& value, R factor) noexcept -> void
+{
+  if constexpr (requires { value *= factor; }) {
+    value *= factor;
+  } else {
+    for (auto& element : value) {
+      element *= factor;
+    }
+  }
+}
+
+}  // namespace detail
+
+/// Rescales values to unit magnitude in place
+/// @tparam tol tolerance of the squared magnitude
+/// @param values values to renormalize
+/// @return number of rescaled values
+/// @pre each value has a finite, nonzero magnitude
+///
+/// Values that satisfy `predicate::unit_norm<tol>` are multiplied by one and
+/// are not modified. Other values are divided by their magnitude. The loop is
+/// free of data-dependent branches so that it may be vectorized. After
+/// renormalization, each value satisfies `predicate::unit_norm<tol>` for
+/// typical tolerances of a few ULP.
+///
+/// Renormalized values may then be wrapped without checking the invariant
+/// again.
+///
+/// ~~~{.cpp}
+/// using rotation =
+///     constrained_value<std::complex<double>, predicate::unit_norm<>>;
+///
+/// renormalize(std::span{values});
+///
+/// auto rotations = std::vector<rotation>{};
+/// rotations.reserve(values.size());
+/// for (const auto& v : values) {
+///   rotations.emplace_back(unchecked, v);
+/// }
+/// ~~~
+///
+template <auto tol = constant::ulp<4>, typename T>
+  requires std::predicate<predicate::unit_norm<tol>, const T&>
+auto renormalize(std::span<T> values) noexcept -> std::size_t
+{
+  using R = std::remove_cvref_t<std::invoke_result_t<projection::norm, T&>>;
+
+  constexpr auto lower = R{1} - tol;
+  constexpr auto upper = R{1} + tol;
+
+  auto count = std::size_t{};
+
+  for (auto& value : values) {
+    const auto n = projection::norm{}(value);
+    const auto valid = (lower <= n) and (n <= upper);
+
+    detail::scale(value, valid ? R{1} : R{1} / std::sqrt(n));
+    count += static_cast<std::size_t>(not valid);
+  }
+
+  return count;
+}
+
+/// Rescales a probability vector to sum to one in place
+/// @tparam tol tolerance of the sum
+/// @param values values to renormalize
+/// @return `true` if the values were rescaled
+/// @pre each value is nonnegative and the sum of the values is finite and
+///     nonzero
+///
+/// If the values satisfy `predicate::simplex<tol>`, the values are not
+/// modified. Otherwise, each value is divided by the pairwise sum of the
+/// values in a single loop that may be vectorized. After renormalization, the
+/// values satisfy `predicate::simplex<tol>` for typical tolerances of a few
+/// ULP.
+///
+/// ~~~{.cpp}
+/// renormalize_simplex(std::span{weights});
+/// const auto p = simplex<std::vector<double>>{std::move(weights)};
+/// ~~~
+///
+template <auto tol = constant::ulp<4>, std::floating_point T>
+auto renormalize_simplex(std::span<T> values) noexcept -> bool
+{
+  constexpr auto lower = T{1} - tol;
+  constexpr auto upper = T{1} + tol;
+
+  auto invalid = 0U;
+  const auto sum = detail::pairwise_sum(std::span<const T>{values}, invalid);
+
+  if ((lower <= sum) and (sum <= upper)) {
+    return false;
+  }
+
+  for (auto& value : values) {
+    value /= sum;
+  }
+  return true;
+}
+
+}  // namespace constrained_value
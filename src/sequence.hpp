@@ -0,0 +1,207 @@
+#pragma once
+
+#include "src/detail/wrapping_cast.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace constrained_value {
+namespace detail {
+
+// Checks if `P` holds for each pair of adjacent values.
+//
+// Pairs are evaluated in blocks without an early exit so that the
+// comparisons of a block may be evaluated on SIMD lanes. An invalid pair ends
+// the check after the block containing it.
+template <typename P, typename T>
+constexpr auto all_adjacent(std::span<const T> values) -> bool
+{
+  constexpr auto block_size = std::size_t{64};
+
+  if (values.size() < 2) {
+    return true;
+  }
+  const auto n = values.size() - 1;
+
+  auto i = std::size_t{};
+  for (; i + block_size <= n; i += block_size) {
+    auto invalid = unsigned{};
+    for (auto k = i; k != i + block_size; ++k) {
+      invalid |= static_cast<unsigned>(not P{}(values[k], values[k + 1]));
+    }
+    if (invalid != 0) {
+      return false;
+    }
+  }
+
+  auto invalid = unsigned{};
+  for (; i != n; ++i) {
+    invalid |= static_cast<unsigned>(not P{}(values[i], values[i + 1]));
+  }
+  return invalid == 0;
+}
+
+}  // namespace detail
+
+namespace predicate {
+
+/// Checks if a value differs from a previous value by at most a bound
+/// @tparam D maximum absolute difference
+///
+/// Binary predicate function object. Integral values are compared without
+/// overflow. Returns `false` if either floating-point value is NaN.
+///
+/// ~~~{.cpp}
+/// delta_at_most<2>{}(10, 12); // true
+/// delta_at_most<2>{}(10, 7);  // false
+/// ~~~
+///
+template <auto D>
+struct delta_at_most
+{
+  template <std::integral T>
+    requires std::integral<decltype(D)>
+  [[nodiscard]] constexpr auto
+  operator()(T previous, T next) const noexcept -> bool
+  {
+    using U = std::make_unsigned_t<T>;
+
+    const auto [lo, hi] = std::minmax(previous, next);
+    return std::cmp_less_equal(
+        detail::wrapping_cast<U>(
+            detail::wrapping_cast<U>(hi) - detail::wrapping_cast<U>(lo)),
+        D);
+  }
+
+  template <std::floating_point T>
+    requires std::floating_point<decltype(D)>
+  [[nodiscard]] constexpr auto
+  operator()(T previous, T next) const noexcept -> bool
+  {
+    return (previous < next ? next - previous : previous - next) <= D;
+  }
+};
+
+/// Checks if a binary predicate holds for each pair of adjacent elements of
+///     a range
+/// @tparam P binary predicate applied to an element and the element after it
+///
+/// Unary predicate function object. Ranges with fewer than two elements
+/// satisfy this predicate. Adjacent pairs are compared in blocks that may be
+/// vectorized.
+///
+/// ~~~{.cpp}
+/// adjacent<less>{}(std::array{1, 2, 4});            // true
+/// adjacent<less>{}(std::array{1, 2, 2});            // false
+/// adjacent<delta_at_most<1>>{}(std::array{1, 2, 4}); // false
+/// ~~~
+///
+template <std::default_initializable P>
+struct adjacent
+{
+  template <std::ranges::contiguous_range R>
+    requires (
+        std::ranges::sized_range<const R> and
+        std::predicate<
+            const P&,
+            std::ranges::range_reference_t<const R>,
+            std::ranges::range_reference_t<const R>>)
+  [[nodiscard]] constexpr auto operator()(const R& values) const -> bool
+  {
+    return detail::all_adjacent<P>(
+        std::span{std::ranges::data(values), std::ranges::size(values)});
+  }
+};
+
+}  // namespace predicate
+
+/// Validates a sequence of values received in batches
+/// @tparam T value type
+/// @tparam P binary predicate applied to a value and the value after it
+///
+/// Retains the last accepted value so that the first value of a batch is
+/// checked against the last value of the previous batch. A batch is accepted
+/// only if `P` holds for every pair of adjacent values; the values within a
+/// batch are checked with `predicate::adjacent<P>`.
+///
+/// `constrained_value` evaluates a new predicate object for each check, so
+/// this type holds the state needed by invariants over a sequence, such as
+/// strictly increasing timestamps.
+///
+/// ~~~{.cpp}
+/// auto timestamps = sequence_checker<std::int64_t, predicate::less>{};
+///
+/// if (not timestamps.push(batch)) {
+///   reject(batch);
+/// }
+/// ~~~
+///
+template <std::copyable T, std::default_initializable P>
+  requires std::predicate<const P&, const T&, const T&>
+class sequence_checker
+{
+  std::optional<T> previous_;
+
+public:
+  using value_type = T;
+
+  /// Predicate type
+  ///
+  using predicate_type = P;
+
+  /// Constructs a checker without a previous value
+  ///
+  constexpr sequence_checker() = default;
+
+  /// Constructs a checker with a previous value
+  /// @param previous value that the next value is checked against
+  ///
+  constexpr explicit sequence_checker(T previous)
+      : previous_{std::move(previous)}
+  {}
+
+  /// Returns the last accepted value, if any
+  ///
+  [[nodiscard]] constexpr auto previous() const noexcept
+      -> const std::optional<T>&
+  {
+    return previous_;
+  }
+
+  /// Checks if a batch would be accepted, without accepting it
+  /// @param batch values following the last accepted value
+  ///
+  [[nodiscard]] constexpr auto valid(std::span<const T> batch) const -> bool
+  {
+    if (batch.empty()) {
+      return true;
+    }
+    return (not previous_ or P{}(*previous_, batch.front())) and
+           predicate::adjacent<P>{}(batch);
+  }
+
+  /// Accepts a batch if it is valid
+  /// @param batch values following the last accepted value
+  /// @return `true` if the batch is accepted
+  ///
+  /// If the batch is not valid, the last accepted value is not changed.
+  ///
+  constexpr auto push(std::span<const T> batch) -> bool
+  {
+    if (not valid(batch)) {
+      return false;
+    }
+    if (not batch.empty()) {
+      previous_ = batch.back();
+    }
+    return true;
+  }
+};
+
+}  // namespace constrained_value
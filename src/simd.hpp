@@ -0,0 +1,76 @@
+#pragma once
+
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#endif
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+
+namespace constrained_value {
+
+#if defined(__cpp_lib_experimental_parallel_simd)
+/// Specifies that a predicate can be evaluated on all lanes of a
+///     `std::experimental::native_simd<T>`, returning a mask
+///
+template <typename P, typename T>
+concept lanewise_predicate =
+    std::default_initializable<P> and std::is_arithmetic_v<T> and
+    requires (const std::experimental::native_simd<T>& lanes) {
+      {
+        std::experimental::all_of(std::invoke(P{}, lanes))
+      } -> std::same_as<bool>;
+    };
+#else
+template <typename P, typename T>
+concept lanewise_predicate = false;
+#endif
+
+/// Checks if every value satisfies a predicate
+/// @tparam P predicate type
+/// @param values values to check
+///
+/// If `P` is a `lanewise_predicate`, the predicate is evaluated on
+/// `native_simd` lanes of `values` and the remaining values are checked
+/// individually. Otherwise, the predicate is evaluated on each value in a loop
+/// without data-dependent branches.
+///
+/// ~~~{.cpp}
+/// if (all_satisfy<predicate::positive>(std::span{samples})) { ... }
+/// ~~~
+///
+template <typename P, typename T>
+  requires std::predicate<P, const T&>
+[[nodiscard]] auto all_satisfy(std::span<const T> values) noexcept(
+    std::is_nothrow_invocable_v<P, const T&>) -> bool
+{
+  auto i = std::size_t{};
+  auto invalid = 0U;
+
+#if defined(__cpp_lib_experimental_parallel_simd)
+  if constexpr (lanewise_predicate<P, T>) {
+    using lanes_type = std::experimental::native_simd<T>;
+
+    auto valid = typename lanes_type::mask_type{true};
+    for (; i + lanes_type::size() <= values.size(); i += lanes_type::size()) {
+      const auto lanes = lanes_type{
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          values.data() + i,
+          std::experimental::element_aligned};
+      valid = valid and std::invoke(P{}, lanes);
+    }
+    invalid = static_cast<unsigned>(not std::experimental::all_of(valid));
+  }
+#endif
+
+  for (; i != values.size(); ++i) {
+    invalid |= static_cast<unsigned>(not std::invoke(P{}, values[i]));
+  }
+
+  return invalid == 0U;
+}
+
+}  // namespace constrained_value
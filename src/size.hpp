@@ -0,0 +1,118 @@
+#pragma once
+
+#include "src/constrained_value.hpp"
+#include "src/detail/assume.hpp"
+#include "src/functional.hpp"
+#include "src/predicate.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <numeric>
+#include <ranges>
+#include <type_traits>
+
+namespace constrained_value {
+namespace detail {
+
+constexpr auto lcm(std::initializer_list<std::size_t> values) noexcept
+    -> std::size_t
+{
+  auto result = std::size_t{1};
+  for (const auto value : values) {
+    result = std::lcm(result, value);
+  }
+  return result;
+}
+
+}  // namespace detail
+
+/// Obtains the minimum number of elements guaranteed by a predicate
+/// @tparam P predicate type
+///
+/// Provides the static data member `value`, equal to `N` for
+/// `predicate::size_at_least<N>` and to the greatest minimum of any predicate
+/// in a `functional::all_of`. Equal to zero for other predicates.
+///
+/// @{
+template <typename P>
+struct min_size_of : std::integral_constant<std::size_t, 0>
+{};
+
+template <std::size_t N>
+struct min_size_of<predicate::size_at_least<N>>
+    : std::integral_constant<std::size_t, N>
+{};
+
+template <typename... Ps>
+struct min_size_of<functional::all_of<Ps...>>
+    : std::integral_constant<
+          std::size_t,
+          std::max({std::size_t{}, min_size_of<Ps>::value...})>
+{};
+/// @}
+
+/// Obtains the number that the number of elements is guaranteed to be a
+///     multiple of by a predicate
+/// @tparam P predicate type
+///
+/// Provides the static data member `value`, equal to `N` for
+/// `predicate::size_multiple_of<N>` and to the least common multiple of the
+/// values of the predicates in a `functional::all_of`. Equal to one for other
+/// predicates.
+///
+/// @{
+template <typename P>
+struct size_granularity_of : std::integral_constant<std::size_t, 1>
+{};
+
+template <std::size_t N>
+struct size_granularity_of<predicate::size_multiple_of<N>>
+    : std::integral_constant<std::size_t, N>
+{};
+
+template <typename... Ps>
+struct size_granularity_of<functional::all_of<Ps...>>
+    : std::integral_constant<
+          std::size_t,
+          detail::lcm({size_granularity_of<Ps>::value...})>
+{};
+/// @}
+
+/// Returns a reference to a constrained range, allowing the optimizer to
+///     assume its size invariant
+/// @param range constrained range
+///
+/// Informs the optimizer that the number of elements of `range` is a multiple
+/// of `size_granularity_of<P>::value` and at least `min_size_of<P>::value`,
+/// where `P` is the predicate of `range`. A loop that processes a fixed number
+/// of elements per iteration can then be compiled without a remainder loop.
+///
+/// ~~~{.cpp}
+/// auto sum(constrained_value<
+///          std::span<const float>,
+///          predicate::size_multiple_of<16>> data) -> float
+/// {
+///   const auto& values = assume_size(data);
+///   for (auto i = std::size_t{}; i != values.size(); i += 16) {
+///     ...
+///   }
+/// }
+/// ~~~
+///
+template <typename CV>
+  requires (
+      is_constrained_value_v<CV> and
+      std::ranges::sized_range<const typename CV::underlying_type>)
+[[nodiscard]] constexpr auto assume_size(const CV& range) noexcept
+    -> const typename CV::underlying_type&
+{
+  using P = typename CV::predicate_type;
+
+  const auto n = std::ranges::size(range.value());
+  detail::assume(n % size_granularity_of<P>::value == 0);
+  detail::assume(n >= min_size_of<P>::value);
+  return range.value();
+}
+
+}  // namespace constrained_value
@@ -0,0 +1,281 @@
+#pragma once
+
+#include "src/constrained_value.hpp"
+#include "src/detail/validate.hpp"
+#include "src/source_location.hpp"
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace constrained_value {
+namespace detail {
+
+template <typename M>
+struct member_pointer_traits;
+
+template <typename R, typename M>
+struct member_pointer_traits<M R::*>
+{
+  using record_type = R;
+  using member_type = M;
+};
+
+template <auto member>
+using member_type_t =
+    typename member_pointer_traits<decltype(member)>::member_type;
+
+}  // namespace detail
+
+/// A structure-of-arrays container for aggregates of constrained values
+/// @tparam Record aggregate type
+/// @tparam members pointers to each data member of `Record`, in declaration
+///     order
+///
+/// Stores each member of `Record` in a separate contiguous column. Columns can
+/// be scanned and appended to independently of the other members, and
+/// appended columns are validated in bulk. Element access returns a proxy
+/// reference to the members of a record that converts to `Record`.
+///
+/// ~~~{.cpp}
+/// struct options
+/// {
+///   positive<double> alpha;
+///   bounded<double, 0, 1> reduction_factor;
+/// };
+///
+/// auto opts = soa_vector<
+///     options, &options::alpha, &options::reduction_factor>{};
+///
+/// opts.append({alphas, factors});
+///
+/// for (auto factor : opts.column<1>()) { ... }
+/// const options first = opts[0];
+/// ~~~
+///
+template <typename Record, auto... members>
+  requires (
+      (sizeof...(members) != 0) and
+      (std::is_member_object_pointer_v<decltype(members)> and ...) and
+      (std::same_as<
+           typename detail::member_pointer_traits<
+               decltype(members)>::record_type,
+           Record> and
+       ...) and
+      (is_constrained_value_v<detail::member_type_t<members>> and ...) and
+      requires (detail::member_type_t<members>... values) {
+        Record{std::move(values)...};
+      })
+class soa_vector
+{
+  static constexpr auto member_pointers = std::tuple{members...};
+
+  std::tuple<std::vector<detail::member_type_t<members>>...> columns_;
+
+  // Invokes `f` to append to each column. If an exception is thrown, the
+  // columns are truncated to their previous size so that all columns retain
+  // the same size.
+  template <typename F>
+  auto append_all(F f) -> void
+  {
+    const auto n = static_cast<std::ptrdiff_t>(size());
+
+    try {
+      f();
+    } catch (...) {
+      std::apply(
+          [n](auto&... column) {
+            (column.erase(column.begin() + n, column.end()), ...);
+          },
+          columns_);
+      throw;
+    }
+  }
+
+  template <std::size_t... Is>
+  auto push_back_impl(const Record& record, std::index_sequence<Is...>) -> void
+  {
+    append_all([this, &record] {
+      (std::get<Is>(columns_).push_back(
+           record.*std::get<Is>(member_pointers)),
+       ...);
+    });
+  }
+
+  template <std::size_t... Is>
+  auto append_impl(
+      const auto& columns,
+      const char* caller,
+      const source_location& sl,
+      std::index_sequence<Is...>) -> void
+  {
+    const auto n = std::get<0>(columns).size();
+    if (((std::get<Is>(columns).size() != n) or ...)) {
+      throw std::invalid_argument{"columns must have the same size"};
+    }
+
+    // validate all columns before modifying any column
+    const auto valid =
+        (detail::validate_each<
+             typename column_type<Is>::predicate_type,
+             typename column_type<Is>::violation_policy_type>(
+             std::get<Is>(columns).data(), n, caller, sl) and
+         ...);
+
+    if (not valid) {
+      return;
+    }
+
+    reserve(size() + n);
+    append_all([this, &columns] {
+      (append_column<Is>(std::get<Is>(columns)), ...);
+    });
+  }
+
+  template <std::size_t I>
+  auto append_column(auto values) -> void
+  {
+    auto& column = std::get<I>(columns_);
+    for (const auto& value : values) {
+      column.emplace_back(unchecked, value);
+    }
+  }
+
+  template <bool is_const>
+  class basic_reference
+  {
+    using container_type =
+        std::conditional_t<is_const, const soa_vector, soa_vector>;
+
+    container_type* container_;
+    std::size_t index_;
+
+    template <std::size_t... Is>
+    auto to_record(std::index_sequence<Is...>) const -> Record
+    {
+      return Record{get<Is>()...};
+    }
+
+  public:
+    constexpr basic_reference(container_type& container, std::size_t index)
+        : container_{&container}, index_{index}
+    {}
+
+    /// Returns a reference to the `I`-th member
+    ///
+    template <std::size_t I>
+    [[nodiscard]] auto get() const -> auto&
+    {
+      return std::get<I>(container_->columns_)[index_];
+    }
+
+    /// Returns a copy of the referenced record
+    ///
+    [[nodiscard]] operator Record() const
+    {
+      return to_record(std::index_sequence_for<decltype(members)...>{});
+    }
+  };
+
+public:
+  /// Type of a record
+  ///
+  using value_type = Record;
+
+  using size_type = std::size_t;
+
+  /// Type of the `I`-th column
+  ///
+  template <std::size_t I>
+  using column_type =
+      std::tuple_element_t<I, std::tuple<detail::member_type_t<members>...>>;
+
+  /// Spans of underlying values, one for each column
+  ///
+  using column_spans = std::tuple<std::span<
+      const typename detail::member_type_t<members>::underlying_type>...>;
+
+  /// Proxy reference to the members of a record
+  ///
+  using reference = basic_reference<false>;
+  using const_reference = basic_reference<true>;
+
+  /// Returns a view of the `I`-th column
+  /// @{
+  template <std::size_t I>
+  [[nodiscard]] auto column() noexcept -> std::span<column_type<I>>
+  {
+    return std::get<I>(columns_);
+  }
+  template <std::size_t I>
+  [[nodiscard]] auto column() const noexcept
+      -> std::span<const column_type<I>>
+  {
+    return std::get<I>(columns_);
+  }
+  /// @}
+
+  /// Appends a record
+  ///
+  /// The members of `record` satisfy their invariants, so they are not
+  /// checked again. If copying a member throws, no column is modified.
+  ///
+  auto push_back(const Record& record) -> void
+  {
+    push_back_impl(record, std::index_sequence_for<decltype(members)...>{});
+  }
+
+  /// Appends records from columns of underlying values
+  /// @param columns underlying values of each member
+  /// @throws std::invalid_argument if columns differ in size
+  /// @pre each value satisfies the invariant of its column
+  ///
+  /// Each column is validated in bulk before any record is appended. Values
+  /// that do not satisfy an invariant are passed to the violation policy of
+  /// the column. If a violation policy returns or an exception is thrown, no
+  /// records are appended.
+  ///
+  auto append(
+      const column_spans& columns,
+      source_location sl = source_location::current()) -> void
+  {
+    append_impl(
+        columns,
+        __PRETTY_FUNCTION__,
+        sl,
+        std::index_sequence_for<decltype(members)...>{});
+  }
+
+  /// Container interface
+  /// @{
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return std::get<0>(columns_).size();
+  }
+  [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+  auto reserve(size_type n) -> void
+  {
+    std::apply([n](auto&... column) { (column.reserve(n), ...); }, columns_);
+  }
+  auto clear() noexcept -> void
+  {
+    std::apply([](auto&... column) { (column.clear(), ...); }, columns_);
+  }
+
+  [[nodiscard]] auto operator[](size_type i) noexcept -> reference
+  {
+    return {*this, i};
+  }
+  [[nodiscard]] auto operator[](size_type i) const noexcept -> const_reference
+  {
+    return {*this, i};
+  }
+  /// @}
+};
+
+}  // namespace constrained_value
@@ -0,0 +1,239 @@
+#pragma once
+
+#include "src/assert_predicate.hpp"
+#include "src/constrained_value.hpp"
+#include "src/source_location.hpp"
+#include "src/violation_policy.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace constrained_value {
+namespace predicate {
+
+/// Checks if a range is sorted
+/// @tparam Compare strict weak order used to compare elements
+///
+/// Unary predicate function object that applies `std::ranges::is_sorted`.
+///
+/// ~~~{.cpp}
+/// sorted<>{}(std::array{1, 2, 2, 3}); // true
+/// sorted<>{}(std::array{1, 3, 2});    // false
+/// ~~~
+///
+template <std::default_initializable Compare = std::ranges::less>
+struct sorted
+{
+  template <std::ranges::forward_range R>
+    requires std::indirect_strict_weak_order<
+        const Compare,
+        std::ranges::iterator_t<const R>>
+  [[nodiscard]] constexpr auto operator()(const R& values) const -> bool
+  {
+    return std::ranges::is_sorted(values, Compare{});
+  }
+};
+
+}  // namespace predicate
+
+/// A vector with elements that are always sorted
+/// @tparam T element type
+/// @tparam Compare strict weak order used to compare elements
+/// @tparam V invariant violation policy
+///
+/// Maintains the invariant `predicate::sorted<Compare>` and provides
+/// algorithms that rely on it. Lookups use a binary search without
+/// data-dependent branches. Merges take linear time. Insertions keep the
+/// elements sorted without checking the invariant again.
+///
+/// ~~~{.cpp}
+/// auto ids = sorted_vector<int>{std::vector{2, 3, 5, 7}};
+/// ids.insert(4);
+/// if (ids.contains(5)) { ... }
+/// ~~~
+///
+template <
+    std::copyable T,
+    std::default_initializable Compare = std::ranges::less,
+    violation_policy<
+        std::vector<T>,
+        predicate::sorted<Compare>,
+        source_location> V = on_violation::print_and_abort>
+  requires std::strict_weak_order<const Compare&, const T&, const T&>
+class sorted_vector
+{
+  std::vector<T> values_;
+
+  // Returns the index of the first element not ordered before `value`
+  [[nodiscard]] constexpr auto lower_bound_index(const T& value) const
+      -> std::size_t
+  {
+    auto n = values_.size();
+    if (n == 0) {
+      return 0;
+    }
+
+    auto first = std::size_t{};
+    while (n > 1) {
+      const auto half = n / 2;
+      first = Compare{}(values_[first + half], value) ? first + half : first;
+      n -= half;
+    }
+    return first + static_cast<std::size_t>(Compare{}(values_[first], value));
+  }
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using const_iterator = typename std::vector<T>::const_iterator;
+
+  /// Predicate type
+  ///
+  using predicate_type = predicate::sorted<Compare>;
+
+  /// Violation policy type
+  ///
+  using violation_policy_type = V;
+
+  /// Constructs an empty vector
+  ///
+  constexpr sorted_vector() = default;
+
+  /// Constructs a sorted vector
+  /// @param values sorted values
+  /// @pre `values` satisfies `predicate::sorted<Compare>`
+  ///
+  constexpr explicit sorted_vector(
+      std::vector<T> values, source_location sl = source_location::current())
+      : values_{std::move(values)}
+  {
+    assert_predicate<predicate_type, V>(values_, __PRETTY_FUNCTION__, sl);
+  }
+
+  /// Constructs a sorted vector without checking the invariant
+  /// @param values sorted values
+  /// @pre `values` satisfies `predicate::sorted<Compare>`
+  ///
+  constexpr sorted_vector(unchecked_t, std::vector<T> values) noexcept
+      : values_{std::move(values)}
+  {
+    assert(predicate_type{}(values_));
+  }
+
+  /// Constructs a sorted vector from a `constrained_value` with the same
+  ///     invariant, without checking the invariant again
+  /// @param values sorted values
+  ///
+  template <typename W>
+  constexpr sorted_vector(
+      constrained_value<std::vector<T>, predicate_type, W> values) noexcept
+      : values_{std::move(values).value()}
+  {}
+
+  /// Returns a reference to the underlying vector
+  ///
+  [[nodiscard]] constexpr auto value() const& noexcept -> const std::vector<T>&
+  {
+    return values_;
+  }
+
+  /// Returns the underlying vector
+  ///
+  [[nodiscard]] constexpr auto value() && noexcept -> std::vector<T>
+  {
+    return std::move(values_);
+  }
+
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator
+  {
+    return values_.begin();
+  }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator
+  {
+    return values_.end();
+  }
+
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type
+  {
+    return values_.size();
+  }
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool
+  {
+    return values_.empty();
+  }
+
+  [[nodiscard]] constexpr auto operator[](size_type i) const noexcept
+      -> const T&
+  {
+    return values_[i];
+  }
+
+  /// Returns an iterator to the first element not ordered before `value`
+  ///
+  [[nodiscard]] constexpr auto lower_bound(const T& value) const
+      -> const_iterator
+  {
+    return begin() + static_cast<std::ptrdiff_t>(lower_bound_index(value));
+  }
+
+  /// Checks if an element equivalent to `value` is contained
+  ///
+  [[nodiscard]] constexpr auto contains(const T& value) const -> bool
+  {
+    const auto i = lower_bound_index(value);
+    return (i != values_.size()) and not Compare{}(value, values_[i]);
+  }
+
+  /// Inserts an element, keeping the elements sorted
+  /// @return iterator to the inserted element
+  ///
+  /// The element is inserted before the first element not ordered before
+  /// `value`.
+  ///
+  constexpr auto insert(T value) -> const_iterator
+  {
+    const auto i = lower_bound(value);
+    return values_.insert(i, std::move(value));
+  }
+
+  /// Merges the elements of another sorted vector
+  ///
+  /// Equivalent elements are retained. Takes time linear in the total number
+  /// of elements.
+  ///
+  constexpr auto merge(const sorted_vector& other) -> void
+  {
+    auto result = std::vector<T>{};
+    result.reserve(values_.size() + other.values_.size());
+    std::ranges::merge(
+        values_, other.values_, std::back_inserter(result), Compare{});
+    values_ = std::move(result);
+  }
+
+  /// Adds the elements of another sorted vector that are not contained
+  ///
+  /// Equivalent elements of `other` are added only as many times as they
+  /// occur in excess of the equivalent elements of `*this`. Takes time linear
+  /// in the total number of elements.
+  ///
+  constexpr auto set_union(const sorted_vector& other) -> void
+  {
+    auto result = std::vector<T>{};
+    result.reserve(values_.size() + other.values_.size());
+    std::ranges::set_union(
+        values_, other.values_, std::back_inserter(result), Compare{});
+    values_ = std::move(result);
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator==(const sorted_vector&, const sorted_vector&) -> bool = default;
+};
+
+}  // namespace constrained_value
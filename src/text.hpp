@@ -0,0 +1,309 @@
+#pragma once
+
+#include "src/fixed_string.hpp"
+#include "src/functional.hpp"
+#include "src/predicate.hpp"
+#include "src/projection.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace constrained_value {
+namespace detail::text {
+
+// Strings are validated in blocks of characters. Each block is checked with
+// a loop of fixed length, without data-dependent branches, that compilers
+// vectorize with 8-bit lanes. The same code is usable during constant
+// evaluation.
+inline constexpr auto block_size = std::size_t{64};
+
+[[nodiscard]] constexpr auto to_byte(char c) noexcept -> std::uint8_t
+{
+  return static_cast<std::uint8_t>(c);
+}
+
+// Returns the bitwise or of the characters of the block starting at `i`
+[[nodiscard]] constexpr auto
+block_bits(std::string_view str, std::size_t i) noexcept -> std::uint8_t
+{
+  auto bits = std::uint8_t{};
+  for (auto k = std::size_t{}; k != block_size; ++k) {
+    bits = static_cast<std::uint8_t>(bits | to_byte(str[i + k]));
+  }
+  return bits;
+}
+
+[[nodiscard]] constexpr auto is_ascii(std::string_view str) noexcept -> bool
+{
+  auto bits = std::uint8_t{};
+
+  auto i = std::size_t{};
+  for (; i + block_size <= str.size(); i += block_size) {
+    bits = static_cast<std::uint8_t>(bits | block_bits(str, i));
+  }
+  for (; i != str.size(); ++i) {
+    bits = static_cast<std::uint8_t>(bits | to_byte(str[i]));
+  }
+
+  return bits < 0x80;
+}
+
+// Checks a byte of a UTF-8 string given the three bytes before it, with
+// bytes before the start of the string given as zero. Returns `true` if the
+// byte is not valid at its position.
+//
+// A byte must be a continuation byte if and only if it follows the lead byte
+// of a sequence that is not complete yet. The remaining rows of Table 3-7 of
+// the Unicode Standard restrict the lead bytes and the second byte of
+// sequences led by E0, ED, F0, and F4.
+[[nodiscard]] constexpr auto utf8_error(
+    std::uint8_t p3, std::uint8_t p2, std::uint8_t p1, std::uint8_t c) noexcept
+    -> bool
+{
+  const auto required = (p1 >= 0xC0) | (p2 >= 0xE0) | (p3 >= 0xF0);
+  const auto continuation = (c & 0xC0) == 0x80;
+  const auto invalid_lead = (c == 0xC0) | (c == 0xC1) | (c >= 0xF5);
+  const auto invalid_second = ((p1 == 0xE0) & (c < 0xA0)) |
+                              ((p1 == 0xED) & (c > 0x9F)) |
+                              ((p1 == 0xF0) & (c < 0x90)) |
+                              ((p1 == 0xF4) & (c > 0x8F));
+
+  return (required != continuation) | invalid_lead | invalid_second;
+}
+
+// Validates well-formed UTF-8 as defined by Table 3-7 of the Unicode
+// Standard. Overlong encodings, surrogates, and code points greater than
+// U+10FFFF are rejected.
+//
+// Each byte is checked using only the three bytes before it, so a block of
+// bytes is checked without data-dependent branches and may be vectorized.
+// Errors are accumulated in 8-bit lanes. A block of ASCII characters is
+// skipped if no sequence before it is incomplete. An invalid byte ends the
+// check after the block containing it.
+[[nodiscard]] constexpr auto is_utf8(std::string_view str) noexcept -> bool
+{
+  const auto n = str.size();
+  const auto at = [str](std::size_t i) { return to_byte(str[i]); };
+  const auto before = [&at](std::size_t i, std::size_t k) {
+    return (i < k) ? std::uint8_t{} : at(i - k);
+  };
+
+  auto invalid = false;
+
+  auto i = std::size_t{};
+  for (; i != n and i < 3; ++i) {
+    invalid |= utf8_error(before(i, 3), before(i, 2), before(i, 1), at(i));
+  }
+
+  for (; i + block_size <= n; i += block_size) {
+    if (block_bits(str, i) < 0x80 and
+        not utf8_error(at(i - 3), at(i - 2), at(i - 1), std::uint8_t{})) {
+      continue;
+    }
+
+    auto errors = std::uint8_t{};
+    for (auto k = std::size_t{}; k != block_size; ++k) {
+      const auto j = i + k;
+      errors = static_cast<std::uint8_t>(
+          errors | utf8_error(at(j - 3), at(j - 2), at(j - 1), at(j)));
+    }
+    if (errors != 0) {
+      return false;
+    }
+  }
+
+  for (; i != n; ++i) {
+    invalid |= utf8_error(at(i - 3), at(i - 2), at(i - 1), at(i));
+  }
+
+  // the string ends as if followed by an ASCII character, so that a
+  // truncated sequence is rejected
+  invalid |= utf8_error(before(n, 3), before(n, 2), before(n, 1), {});
+
+  return not invalid;
+}
+
+// Membership of a character in a set is tested with a pair of lookup tables
+// indexed by the low and high nibbles of the character. Each distinct set of
+// low nibbles that occurs with a high nibble is assigned a bit. `high[h]`
+// contains the bit assigned to `h` and `low[l]` contains the bits of all sets
+// that contain `l`, so that `c` is a member if `low[c % 16] & high[c / 16]`
+// is nonzero. As there are at most 16 distinct sets, the tables represent
+// any set of characters.
+struct nibble_table
+{
+  std::array<std::uint16_t, 16> low{};
+  std::array<std::uint16_t, 16> high{};
+
+  [[nodiscard]] constexpr auto contains(char c) const noexcept -> bool
+  {
+    const auto b = to_byte(c);
+    return (low[b & 0xFU] & high[b >> 4U]) != 0;
+  }
+};
+
+// Not defined and not `constexpr`. Invoking this function during constant
+// evaluation results in a compile error that names the failure.
+auto charset_syntax_error() -> void;
+
+// Constructs the lookup tables for a set of characters given as a sequence of
+// characters and character ranges, e.g. `"0-9a-fA-F"`. A `-` that is the
+// first or last character denotes itself.
+template <std::size_t N>
+[[nodiscard]] consteval auto make_nibble_table(const fixed_string<N>& chars)
+    -> nibble_table
+{
+  const auto str = chars.view();
+
+  auto members = std::array<std::uint16_t, 16>{};
+  for (auto i = std::size_t{}; i != str.size(); ++i) {
+    auto lo = to_byte(str[i]);
+    auto hi = lo;
+
+    if (i + 2 < str.size() and str[i + 1] == '-') {
+      hi = to_byte(str[i + 2]);
+      i += 2;
+    }
+    if (hi < lo) {
+      charset_syntax_error();
+    }
+
+    for (auto c = unsigned{lo}; c <= hi; ++c) {
+      members[c >> 4U] |= static_cast<std::uint16_t>(1U << (c & 0xFU));
+    }
+  }
+
+  auto table = nibble_table{};
+  auto distinct = std::array<std::uint16_t, 16>{};
+  auto count = std::size_t{};
+
+  for (auto h = std::size_t{}; h != members.size(); ++h) {
+    if (members[h] == 0) {
+      continue;
+    }
+
+    auto k = std::size_t{};
+    while (k != count and distinct[k] != members[h]) {
+      ++k;
+    }
+    if (k == count) {
+      distinct[count++] = members[h];
+    }
+
+    const auto bit = static_cast<std::uint16_t>(1U << k);
+    table.high[h] = bit;
+    for (auto l = std::size_t{}; l != table.low.size(); ++l) {
+      if (((members[h] >> l) & 1U) != 0) {
+        table.low[l] |= bit;
+      }
+    }
+  }
+
+  return table;
+}
+
+}  // namespace detail::text
+
+namespace predicate {
+
+/// Checks if a string contains only ASCII characters
+///
+/// Unary predicate function object that checks blocks of 64 characters
+/// without data-dependent branches.
+///
+/// ~~~{.cpp}
+/// ascii{}("key");       // true
+/// ascii{}("schlüssel"); // false
+/// ~~~
+///
+struct ascii
+{
+  [[nodiscard]] constexpr auto operator()(std::string_view str) const noexcept
+      -> bool
+  {
+    return detail::text::is_ascii(str);
+  }
+};
+
+/// Checks if a string is well-formed UTF-8
+///
+/// Unary predicate function object that rejects ill-formed sequences,
+/// overlong encodings, surrogates, and code points greater than U+10FFFF.
+/// Blocks of 64 characters are checked without data-dependent branches, and
+/// blocks of ASCII characters are skipped.
+///
+/// ~~~{.cpp}
+/// utf8{}("schlüssel"); // true
+/// utf8{}("\xC0\xAF");  // false, overlong encoding of '/'
+/// ~~~
+///
+struct utf8
+{
+  [[nodiscard]] constexpr auto operator()(std::string_view str) const noexcept
+      -> bool
+  {
+    return detail::text::is_utf8(str);
+  }
+};
+
+/// Checks if every character of a string is a member of a set
+/// @tparam chars characters and character ranges in the set
+///
+/// Unary predicate function object. The set is given as a sequence of
+/// characters and ranges, e.g. `"0-9a-fA-F"`, where a `-` that is the first or
+/// last character denotes itself. Membership is tested with a pair of 16-entry
+/// lookup tables indexed by the low and high nibbles of each character,
+/// constructed at compile time. The string is checked without data-dependent
+/// branches, but each character is looked up individually; the lookups are
+/// not vectorized.
+///
+/// ~~~{.cpp}
+/// using hex_string = constrained_value<
+///     std::string,
+///     predicate::charset<"0-9a-fA-F">>;
+/// ~~~
+///
+template <fixed_string chars>
+struct charset
+{
+  [[nodiscard]] constexpr auto operator()(std::string_view str) const noexcept
+      -> bool
+  {
+    constexpr auto table = detail::text::make_nibble_table(chars);
+
+    auto invalid = 0U;
+    for (const auto c : str) {
+      invalid |= static_cast<unsigned>(not table.contains(c));
+    }
+    return invalid == 0U;
+  }
+};
+
+/// Checks if the number of elements of a range is within bounds
+/// @tparam lo minimum number of elements
+/// @tparam hi maximum number of elements
+///
+/// For strings, the number of elements is the number of code units.
+///
+/// ~~~{.cpp}
+/// using name = constrained_value<
+///     std::string,
+///     functional::all_of<
+///         predicate::utf8,
+///         predicate::length_between<1, 64>>>;
+/// ~~~
+///
+template <std::size_t lo, std::size_t hi>
+  requires (lo <= hi)
+struct length_between
+    : functional::compose<
+          projection::size,
+          functional::all_of<
+              greater_equal::bind_back<lo>,
+              less_equal::bind_back<hi>>>
+{};
+
+}  // namespace predicate
+}  // namespace constrained_value
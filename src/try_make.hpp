@@ -0,0 +1,55 @@
+#pragma once
+
+#include "src/constrained_value.hpp"
+#include "src/expected.hpp"
+#include "src/violation_info.hpp"
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace constrained_value {
+
+/// Constructs a constrained_value or returns the invariant violation
+/// @tparam CV `constrained_value` type
+/// @param value value of the underlying type
+///
+/// Evaluates the invariant predicate once. If satisfied, the value is moved
+/// into the result without being checked again. Otherwise, the value is
+/// returned in a `violation_info` and the violation policy of `CV` is not
+/// invoked. Neither path copies the value, formats, or captures a source
+/// location.
+///
+/// ~~~{.cpp}
+/// const auto x = try_make<positive<int>>(input);
+/// if (not x) {
+///   return x.error();
+/// }
+/// ~~~
+///
+template <typename CV>
+  requires is_constrained_value_v<CV>
+[[nodiscard]] constexpr auto
+try_make(typename CV::underlying_type value) noexcept(
+    std::is_nothrow_move_constructible_v<typename CV::underlying_type> and
+    std::is_nothrow_move_constructible_v<CV> and
+    std::is_nothrow_invocable_v<
+        typename CV::predicate_type,
+        const typename CV::underlying_type&>)
+    -> expected<
+        CV,
+        violation_info<
+            typename CV::underlying_type,
+            typename CV::predicate_type>>
+{
+  using T = typename CV::underlying_type;
+  using P = typename CV::predicate_type;
+
+  if (not std::invoke(P{}, std::as_const(value))) {
+    return unexpected{violation_info<T, P>{std::move(value)}};
+  }
+
+  return CV{unchecked, std::move(value)};
+}
+
+}  // namespace constrained_value
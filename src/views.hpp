@@ -0,0 +1,383 @@
+#pragma once
+
+#include "src/constrained_value.hpp"
+#include "src/simd.hpp"
+#include "src/source_location.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace constrained_value {
+
+/// A view of a range of underlying values as constrained values
+/// @tparam V underlying view
+/// @tparam CV `constrained_value` type
+///
+/// Contiguous ranges of the underlying type are checked in blocks with
+/// `all_satisfy` as the view is iterated. Values before the first invalid
+/// value of a block are converted to `CV` without being checked again. Other
+/// values are checked when dereferenced, as if by the constructor of `CV`, so
+/// that the elements of a range such as `std::views::transform` are evaluated
+/// once. Each value that does not satisfy the invariant is passed to the
+/// violation policy of `CV` and reported at the source location where the
+/// view was created.
+///
+template <std::ranges::view V, typename CV>
+  requires (
+      std::ranges::forward_range<V> and is_constrained_value_v<CV> and
+      std::convertible_to<
+          std::ranges::range_reference_t<V>,
+          typename CV::underlying_type>)
+class constrain_view
+    : public std::ranges::view_interface<constrain_view<V, CV>>
+{
+  using T = typename CV::underlying_type;
+  using P = typename CV::predicate_type;
+
+  V base_;
+  source_location sl_;
+
+  // Binds the underlying value of a range element, converting if necessary.
+  // A converted value is valid until the end of the full-expression.
+  static constexpr auto as_underlying(const T& value) noexcept -> const T&
+  {
+    return value;
+  }
+
+  template <bool is_const>
+  class basic_sentinel;
+
+  template <bool is_const>
+  class basic_iterator
+  {
+    using parent_type =
+        std::conditional_t<is_const, const constrain_view, constrain_view>;
+    using base_type = std::conditional_t<is_const, const V, V>;
+    using base_iterator = std::ranges::iterator_t<base_type>;
+
+    static constexpr auto contiguous_values =
+        std::contiguous_iterator<base_iterator> and
+        std::same_as<std::iter_value_t<base_iterator>, T>;
+
+    static constexpr auto block_size =
+        static_cast<std::iter_difference_t<base_iterator>>(
+            std::max(std::size_t{4096} / sizeof(T), std::size_t{1}));
+
+    base_iterator current_{};
+    parent_type* parent_{};
+
+    // Number of values from `current_` to the end of the checked block
+    std::iter_difference_t<base_iterator> checked_{};
+
+    // Number of values from `current_` known to satisfy `P`. If zero, the
+    // value at `current_` is checked when dereferenced.
+    std::iter_difference_t<base_iterator> valid_{};
+
+    // Checks the block of values from `current_`, recording its size and the
+    // number of leading values that satisfy `P`. Values in the block after
+    // an invalid value are checked when dereferenced, so that the block is
+    // not checked again on each increment.
+    constexpr auto check_block() -> void
+    {
+      const auto block_last = std::ranges::next(
+          current_, block_size, std::ranges::end(parent_->base_));
+
+      checked_ = block_last - current_;
+      valid_ = checked_;
+
+      if (all_satisfy<P>(std::span<const T>{
+              std::to_address(current_), std::to_address(block_last)}))
+          [[likely]] {
+        return;
+      }
+
+      valid_ = std::ranges::find_if_not(current_, block_last, P{}) - current_;
+    }
+
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = CV;
+    using difference_type = std::iter_difference_t<base_iterator>;
+
+    basic_iterator() = default;
+
+    constexpr basic_iterator(parent_type& parent, base_iterator current)
+        : current_{std::move(current)}, parent_{&parent}
+    {
+      if constexpr (contiguous_values) {
+        check_block();
+      }
+    }
+
+    [[nodiscard]] constexpr auto operator*() const -> CV
+    {
+      if (valid_ != 0) [[likely]] {
+        return CV{unchecked, T{as_underlying(*current_)}};
+      }
+      return CV{T{as_underlying(*current_)}, parent_->sl_};
+    }
+
+    constexpr auto operator++() -> basic_iterator&
+    {
+      ++current_;
+
+      if constexpr (contiguous_values) {
+        if (checked_ > 1) [[likely]] {
+          --checked_;
+          if (valid_ != 0) {
+            --valid_;
+          }
+        } else {
+          check_block();
+        }
+      }
+      return *this;
+    }
+
+    constexpr auto operator++(int) -> basic_iterator
+    {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    [[nodiscard]] friend constexpr auto
+    operator==(const basic_iterator& x, const basic_iterator& y) -> bool
+    {
+      return x.current_ == y.current_;
+    }
+
+    [[nodiscard]] friend constexpr auto
+    operator==(const basic_iterator& x, const basic_sentinel<is_const>& y)
+        -> bool
+    {
+      return x.current_ == y.base();
+    }
+  };
+
+  template <bool is_const>
+  class basic_sentinel
+  {
+    using base_type = std::conditional_t<is_const, const V, V>;
+
+    std::ranges::sentinel_t<base_type> end_{};
+
+  public:
+    basic_sentinel() = default;
+
+    constexpr explicit basic_sentinel(std::ranges::sentinel_t<base_type> end)
+        : end_{std::move(end)}
+    {}
+
+    [[nodiscard]] constexpr auto base() const
+        -> std::ranges::sentinel_t<base_type>
+    {
+      return end_;
+    }
+  };
+
+public:
+  constrain_view()
+    requires std::default_initializable<V>
+  = default;
+
+  /// Constructs a view of underlying values
+  /// @param base underlying view
+  /// @param sl source location reported on an invariant violation
+  ///
+  constexpr explicit constrain_view(
+      V base, source_location sl = source_location::current())
+      : base_{std::move(base)}, sl_{sl}
+  {}
+
+  /// Returns the underlying view
+  /// @{
+  [[nodiscard]] constexpr auto base() const& -> V
+    requires std::copy_constructible<V>
+  {
+    return base_;
+  }
+  [[nodiscard]] constexpr auto base() && -> V { return std::move(base_); }
+  /// @}
+
+  /// Range interface
+  /// @{
+  [[nodiscard]] constexpr auto begin() -> basic_iterator<false>
+  {
+    return {*this, std::ranges::begin(base_)};
+  }
+  [[nodiscard]] constexpr auto begin() const -> basic_iterator<true>
+    requires std::ranges::forward_range<const V>
+  {
+    return {*this, std::ranges::begin(base_)};
+  }
+
+  [[nodiscard]] constexpr auto end() -> basic_sentinel<false>
+  {
+    return basic_sentinel<false>{std::ranges::end(base_)};
+  }
+  [[nodiscard]] constexpr auto end() const -> basic_sentinel<true>
+    requires std::ranges::forward_range<const V>
+  {
+    return basic_sentinel<true>{std::ranges::end(base_)};
+  }
+
+  [[nodiscard]] constexpr auto size()
+    requires std::ranges::sized_range<V>
+  {
+    return std::ranges::size(base_);
+  }
+  [[nodiscard]] constexpr auto size() const
+    requires std::ranges::sized_range<const V>
+  {
+    return std::ranges::size(base_);
+  }
+  /// @}
+};
+
+/// Range adaptors for constrained values
+///
+namespace views {
+namespace detail {
+
+template <typename CV>
+struct satisfies
+{
+  [[nodiscard]] constexpr auto
+  operator()(const typename CV::underlying_type& value) const -> bool
+  {
+    return std::invoke(typename CV::predicate_type{}, value);
+  }
+};
+
+template <typename CV>
+struct to_unchecked
+{
+  [[nodiscard]] constexpr auto
+  operator()(typename CV::underlying_type value) const -> CV
+  {
+    return CV{unchecked, std::move(value)};
+  }
+};
+
+template <typename CV>
+struct constrain_fn;
+
+template <typename CV>
+class constrain_closure
+{
+  source_location sl_;
+
+public:
+  constexpr explicit constrain_closure(source_location sl) : sl_{sl} {}
+
+  // Converts the adaptor used without a call, as in `r | constrain<CV>`. The
+  // default argument is evaluated where the conversion occurs, capturing the
+  // source location of the pipeline.
+  constexpr constrain_closure(
+      const constrain_fn<CV>&, source_location sl = source_location::current())
+      : sl_{sl}
+  {}
+
+  template <std::ranges::viewable_range R>
+  [[nodiscard]] friend constexpr auto
+  operator|(R&& r, const constrain_closure& closure)
+      -> constrain_view<std::views::all_t<R>, CV>
+  {
+    return constrain_view<std::views::all_t<R>, CV>{
+        std::views::all(std::forward<R>(r)), closure.sl_};
+  }
+};
+
+template <typename CV>
+struct constrain_fn
+{
+  template <std::ranges::viewable_range R>
+  [[nodiscard]] constexpr auto operator()(
+      R&& r, source_location sl = source_location::current()) const
+      -> constrain_view<std::views::all_t<R>, CV>
+  {
+    return constrain_view<std::views::all_t<R>, CV>{
+        std::views::all(std::forward<R>(r)), sl};
+  }
+
+  [[nodiscard]] constexpr auto
+  operator()(source_location sl = source_location::current()) const
+      -> constrain_closure<CV>
+  {
+    return constrain_closure<CV>{sl};
+  }
+
+  template <std::ranges::viewable_range R>
+  [[nodiscard]] friend constexpr auto
+  operator|(R&& r, constrain_closure<CV> closure)
+      -> constrain_view<std::views::all_t<R>, CV>
+  {
+    return std::forward<R>(r) | closure;
+  }
+};
+
+template <typename CV>
+struct valid_only_fn
+{
+  template <std::ranges::viewable_range R>
+  [[nodiscard]] constexpr auto operator()(R&& r) const
+  {
+    return std::views::transform(
+        std::views::filter(std::forward<R>(r), satisfies<CV>{}),
+        to_unchecked<CV>{});
+  }
+
+  template <std::ranges::viewable_range R>
+  [[nodiscard]] friend constexpr auto operator|(R&& r, const valid_only_fn& fn)
+  {
+    return fn(std::forward<R>(r));
+  }
+};
+
+}  // namespace detail
+
+/// Range adaptor that views underlying values as constrained values
+/// @tparam CV `constrained_value` type
+///
+/// Produces a `constrain_view`, checking elements as the view is iterated. A
+/// value that does not satisfy the invariant invokes the
+/// violation policy of `CV` when dereferenced and is reported at the source
+/// location of the pipeline or call that created the view.
+///
+/// ~~~{.cpp}
+/// for (auto x : samples | views::transform(scale)
+///                       | views::constrain<positive<double>>()) { ... }
+/// ~~~
+///
+template <typename CV>
+  requires is_constrained_value_v<CV>
+inline constexpr auto constrain = detail::constrain_fn<CV>{};
+
+/// Range adaptor that views underlying values satisfying an invariant as
+///     constrained values
+/// @tparam CV `constrained_value` type
+///
+/// Values that do not satisfy the invariant are skipped and the violation
+/// policy of `CV` is not invoked. Each remaining value is converted to `CV`
+/// without being checked again.
+///
+/// ~~~{.cpp}
+/// for (auto x : samples | views::valid_only<positive<double>>) { ... }
+/// ~~~
+///
+template <typename CV>
+  requires is_constrained_value_v<CV>
+inline constexpr auto valid_only = detail::valid_only_fn<CV>{};
+
+}  // namespace views
+}  // namespace constrained_value
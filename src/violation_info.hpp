@@ -0,0 +1,90 @@
+#pragma once
+
+#include "src/detail/type_name.hpp"
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#include <algorithm>
+#include <concepts>
+#include <string_view>
+
+namespace constrained_value {
+
+/// Record of a value that does not satisfy an invariant
+/// @tparam T type with invariant
+/// @tparam P invariant predicate
+///
+/// A lightweight description of an invariant violation. The predicate is
+/// identified by type and only the offending value is stored.
+///
+template <typename T, typename P>
+struct violation_info
+{
+  /// Value that does not satisfy `P`
+  ///
+  T value;
+
+  /// Returns the name of the invariant predicate
+  ///
+  [[nodiscard]] static constexpr auto predicate_name() noexcept
+      -> std::string_view
+  {
+    return detail::type_name<P>();
+  }
+
+  [[nodiscard]] friend auto operator==(
+      const violation_info&, const violation_info&) -> bool = default;
+};
+
+#if defined(__cpp_lib_format)
+namespace detail {
+
+/// Specifies that `std::format` can format a type
+///
+template <typename T, typename CharT = char>
+concept formattable = std::semiregular<std::formatter<T, CharT>>;
+
+}  // namespace detail
+#endif
+
+}  // namespace constrained_value
+
+#if defined(__cpp_lib_format)
+/// Formats a `violation_info` as `predicate(value) is false`
+///
+/// The format specification is applied to the offending value.
+///
+/// @note Only available if the standard library provides `std::format`. The
+///     toolchains used in CI do not, so this specialization is not built or
+///     tested there and is not supported.
+///
+template <typename T, typename P, typename CharT>
+  requires ::constrained_value::detail::formattable<T, CharT>
+struct std::formatter<::constrained_value::violation_info<T, P>, CharT>
+{
+  // `mutable` as `std::formatter<T>::format` is not `const` qualified in all
+  // standard library implementations
+  mutable std::formatter<T, CharT> value_formatter;
+
+  constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
+  {
+    return value_formatter.parse(ctx);
+  }
+
+  template <typename FormatContext>
+  auto format(
+      const ::constrained_value::violation_info<T, P>& info,
+      FormatContext& ctx) const
+  {
+    auto out = std::ranges::copy(info.predicate_name(), ctx.out()).out;
+    *out++ = CharT{'('};
+
+    ctx.advance_to(out);
+    out = value_formatter.format(info.value, ctx);
+
+    return std::ranges::copy(std::string_view{") is false"}, out).out;
+  }
+};
+#endif
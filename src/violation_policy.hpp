@@ -1,11 +1,17 @@
 #pragma once
 
+#include "src/detail/message_buffer.hpp"
 #include "src/detail/type_name.hpp"
 #include "src/source_location.hpp"
 
+#include <atomic>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <string_view>
 #include <type_traits>
 
 namespace constrained_value {
@@ -33,21 +39,201 @@ struct on_violation
 {
   /// Violation policy that prints an informational message and then aborts
   ///
+  /// If the value is a number or a string, the message is formatted into a
+  /// fixed-size stack buffer with `std::to_chars`, avoiding iostream state,
+  /// locale handling and heap allocation. Messages longer than the buffer are
+  /// truncated. Other values are written to `std::cerr` if they have a stream
+  /// insertion operator, and are otherwise printed by type name.
+  ///
   struct print_and_abort
   {
+    static constexpr auto message_size = std::size_t{1024};
+
     template <typename T, typename P, typename SourceLocation>
     auto operator()(
         const T& value, const P&, const char* caller, const SourceLocation& sl)
         const -> void
     {
-      std::cerr
-          << "file: " << sl.file_name() << "(" << sl.line() << ":"
-          << sl.column() << ") `" << sl.function_name() << "`: "
-          << "contract violated in `" << caller << "`. "
-          << detail::type_name<P>() << "(" << value << ") is false.\n";
+      if constexpr (
+          detail::chars_formattable<T> or
+          std::convertible_to<const T&, std::string_view>) {
+        const auto message =
+            format_message(value, detail::type_name<P>(), caller, sl);
+        std::fwrite(
+            message.view().data(), sizeof(char), message.view().size(), stderr);
+      } else {
+        stream_message(value, detail::type_name<P>(), caller, sl);
+      }
 
       std::abort();
     }
+
+    /// Formats the message printed for a number or a string
+    ///
+    template <typename T, typename SourceLocation>
+      requires (
+          detail::chars_formattable<T> or
+          std::convertible_to<const T&, std::string_view>)
+    [[nodiscard]] static auto format_message(
+        const T& value,
+        std::string_view predicate,
+        const char* caller,
+        const SourceLocation& sl) noexcept
+        -> detail::message_buffer<message_size>
+    {
+      auto message = detail::message_buffer<message_size>{};
+
+      message.append("file: ")
+          .append(sl.file_name())
+          .append("(")
+          .append(sl.line())
+          .append(":")
+          .append(sl.column())
+          .append(") `")
+          .append(sl.function_name())
+          .append("`: contract violated in `")
+          .append(caller)
+          .append("`. ")
+          .append(predicate)
+          .append("(");
+
+      if constexpr (detail::chars_formattable<T>) {
+        message.append(value);
+      } else {
+        message.append(std::string_view{value});
+      }
+
+      message.append(") is false.\n");
+      return message;
+    }
+
+  private:
+    template <typename T, typename SourceLocation>
+    static auto stream_message(
+        const T& value,
+        std::string_view predicate,
+        const char* caller,
+        const SourceLocation& sl) -> void
+    {
+      std::cerr << "file: " << sl.file_name() << "(" << sl.line() << ":"
+                << sl.column() << ") `" << sl.function_name() << "`: "
+                << "contract violated in `" << caller << "`. " << predicate
+                << "(";
+
+      // values without a stream insertion operator are printed by type
+      if constexpr (requires { std::cerr << value; }) {
+        std::cerr << value;
+      } else {
+        std::cerr << detail::type_name<T>() << "{...}";
+      }
+
+      std::cerr << ") is false.\n";
+    }
+  };
+
+  /// Violation policy that invokes a handler installed at runtime
+  ///
+  /// Invokes a process-wide handler, allowing the response to a violation to
+  /// be changed without recompiling, e.g. from aborting to logging and
+  /// continuing. Handlers are installed atomically with `set_handler`. The
+  /// default handler behaves as `print_and_abort` and is invoked directly
+  /// instead of through the handler pointer.
+  ///
+  /// As violation policies are only invoked if an invariant is not satisfied,
+  /// this policy adds no cost to a successful check.
+  ///
+  /// ~~~{.cpp}
+  /// using port = bounded<int, 1, 65535, on_violation::dispatch{}>;
+  ///
+  /// on_violation::dispatch::set_handler(
+  ///     [](const on_violation::dispatch::context& ctx) {
+  ///       log_error(ctx.caller, ctx.predicate);
+  ///     });
+  /// ~~~
+  ///
+  struct dispatch
+  {
+    /// Description of an invariant violation passed to a handler
+    ///
+    struct context
+    {
+      /// Name of the invariant predicate
+      std::string_view predicate;
+      /// Name of the type with the invariant
+      std::string_view type;
+      /// Pointer to the value that does not satisfy the invariant
+      const void* value;
+      /// Function verifying the invariant
+      const char* caller;
+      /// Source location invoking `caller`
+      const char* file_name;
+      const char* function_name;
+      std::uint_least32_t line;
+      std::uint_least32_t column;
+    };
+
+    /// Violation handler type
+    ///
+    using handler_type = void (*)(const context&);
+
+    /// Handler that prints an informational message and then aborts
+    ///
+    [[noreturn]] static auto default_handler(const context& ctx) -> void
+    {
+      std::cerr << "file: " << ctx.file_name << "(" << ctx.line << ":"
+                << ctx.column << ") `" << ctx.function_name << "`: "
+                << "contract violated in `" << ctx.caller << "`. "
+                << ctx.predicate << "(" << ctx.type << "{...}) is false.\n";
+
+      std::abort();
+    }
+
+    /// Installs a violation handler
+    /// @param handler handler to install, or `nullptr` to install the default
+    ///     handler
+    /// @return previously installed handler
+    ///
+    static auto set_handler(handler_type handler) noexcept -> handler_type
+    {
+      return handler_.exchange(
+          handler == nullptr ? &default_handler : handler,
+          std::memory_order_acq_rel);
+    }
+
+    /// Returns the installed violation handler
+    ///
+    [[nodiscard]] static auto handler() noexcept -> handler_type
+    {
+      return handler_.load(std::memory_order_acquire);
+    }
+
+    template <typename T, typename P, typename SourceLocation>
+    auto operator()(
+        const T& value,
+        const P& p,
+        const char* caller,
+        const SourceLocation& sl) const -> void
+    {
+      const auto h = handler();
+
+      if (h == &default_handler) [[likely]] {
+        print_and_abort{}(value, p, caller, sl);
+      } else {
+        h(context{
+            .predicate = detail::type_name<P>(),
+            .type = detail::type_name<T>(),
+            .value = &value,
+            .caller = caller,
+            .file_name = sl.file_name(),
+            .function_name = sl.function_name(),
+            .line = static_cast<std::uint_least32_t>(sl.line()),
+            .column = static_cast<std::uint_least32_t>(sl.column())});
+      }
+    }
+
+  private:
+    static constinit inline std::atomic<handler_type> handler_{
+        &default_handler};
   };
 };
 
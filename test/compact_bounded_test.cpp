@@ -0,0 +1,114 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+struct not_a_violation_policy
+{};
+
+template <auto violation_policy>
+concept valid_violation_policy = requires {
+  typename cnv::compact_bounded<int, 0, 200, violation_policy>;
+};
+
+template <typename CV>
+using storage_t = typename CV::storage_type;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("selects the smallest storage type") = [] {
+    static_assert(
+        std::is_same_v<
+            storage_t<cnv::compact_bounded<int, 0, 200>>,
+            std::uint8_t>);
+    static_assert(
+        std::is_same_v<
+            storage_t<cnv::compact_bounded<int, -100, 155>>,
+            std::uint8_t>);
+    static_assert(
+        std::is_same_v<
+            storage_t<cnv::compact_bounded<int, -100, 156>>,
+            std::uint16_t>);
+    static_assert(
+        std::is_same_v<
+            storage_t<cnv::compact_bounded<long, 0, 100'000>>,
+            std::uint32_t>);
+    static_assert(
+        std::is_same_v<
+            storage_t<cnv::compact_bounded<
+                long long,
+                std::numeric_limits<long long>::min(),
+                std::numeric_limits<long long>::max()>>,
+            std::uint64_t>);
+
+    static_assert(sizeof(cnv::compact_bounded<int, 0, 200>) == 1);
+    static_assert(
+        std::is_trivially_copyable_v<cnv::compact_bounded<int, 0, 200>>);
+  };
+
+  test("reads and writes the underlying type") = [] {
+    constexpr auto x = cnv::compact_bounded<int, -100, 100>{-42};
+    static_assert(x.value() == -42);
+
+    auto y = cnv::compact_bounded<int, -100, 100>{};
+    expect(0_i == y.value());
+
+    y = 100;
+    const int z = y;
+    expect(100_i == z);
+  };
+
+  test("invokes the violation policy for values outside the bounds") = [] {
+    using T = cnv::compact_bounded<int, 0, 200, throw_on_violation{}>;
+
+    expect(nothrow([] { (void)T{200}; }));
+    expect(throws<invalid_value_error>([] { (void)T{201}; }));
+    expect(throws<invalid_value_error>([] { (void)T{-1}; }));
+  };
+
+  test("constrains the violation policy") = [] {
+    static_assert(valid_violation_policy<throw_on_violation{}>);
+    static_assert(not valid_violation_policy<not_a_violation_policy{}>);
+  };
+
+  test("compares values") = [] {
+    using T = cnv::compact_bounded<int, -10, 10>;
+
+    static_assert(T{-3} < T{2});
+    static_assert(T{2} == T{2});
+    static_assert(T{-3} < 0);
+    static_assert(T{5} == 5);
+    static_assert(T{5} != cnv::bounded<int, 0, 10>{6});
+  };
+
+  test("is a drop in replacement for bounded in aggregates") = [] {
+    struct pixel
+    {
+      cnv::compact_bounded<int, 0, 200> r;
+      cnv::compact_bounded<int, 0, 200> g;
+      cnv::compact_bounded<int, 0, 200> b;
+    };
+
+    static_assert(sizeof(pixel) == 3);
+
+    const auto p = pixel{.r = 1, .g = 2, .b = 200};
+    expect(200_i == p.b.value());
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,110 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct counted
+{
+  static inline auto copies = 0;
+
+  int value{};
+
+  constexpr explicit counted(int v) : value{v} {}
+  counted(const counted& other) : value{other.value} { ++copies; }
+  auto operator=(const counted& other) -> counted&
+  {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  ~counted() = default;
+
+  friend auto operator<=>(const counted&, const counted&) = default;
+  friend auto operator<<(std::ostream& os, const counted& c) -> std::ostream&
+  {
+    return os << c.value;
+  }
+};
+
+using nonempty_string = cnv::constrained_value<
+    std::string,
+    decltype([](const std::string& s) { return not s.empty(); })>;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("compares constrained values by reference") = [] {
+    using positive_counted = cnv::constrained_value<
+        counted,
+        decltype([](const counted& c) { return c.value > 0; })>;
+
+    const auto x = positive_counted{counted{1}};
+    const auto y = positive_counted{counted{2}};
+    const auto z = counted{2};
+
+    counted::copies = 0;
+
+    expect(x != y);
+    expect(x < y);
+    expect(y == z);
+    expect(z == y);
+    expect(x < z);
+    expect(std::strong_ordering::less == (x <=> y));
+
+    expect(0_i == counted::copies);
+  };
+
+  test("compares constrained values with different predicates") = [] {
+    constexpr auto x = cnv::positive<int>{1};
+    constexpr auto y = cnv::nonnegative<int>{1};
+    constexpr auto z = cnv::bounded<int, 0, 10>{2};
+
+    static_assert(x == y);
+    static_assert(y == x);
+    static_assert(x < z);
+    static_assert(z > y);
+    static_assert(x == 1);
+    static_assert(1 == x);
+    static_assert(x < 2.0);
+  };
+
+  test("hashes as the underlying value") = [] {
+    const auto s = nonempty_string{std::string{"key"}};
+
+    expect(std::hash<std::string>{}(s.value()) ==
+           std::hash<nonempty_string>{}(s));
+    expect(cnv::transparent_hash{}(s) ==
+           cnv::transparent_hash{}(std::string_view{"key"}));
+    expect(cnv::transparent_hash{}(s) == cnv::transparent_hash{}("key"));
+  };
+
+  test("looks up unordered containers by the underlying type") = [] {
+    auto m = std::unordered_map<
+        nonempty_string,
+        int,
+        cnv::transparent_hash,
+        cnv::transparent_equal_to>{};
+
+    m.emplace(std::string{"one"}, 1);
+    m.emplace(std::string{"two"}, 2);
+
+    expect(m.contains(std::string_view{"one"}));
+    expect(m.contains("two"));
+    expect(not m.contains(std::string{"three"}));
+    expect(2_i == m.find(std::string_view{"two"})->second);
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
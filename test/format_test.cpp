@@ -0,0 +1,88 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#if __has_include(<format>)
+#include <array>
+#include <format>
+#endif
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("violation_info names the predicate") = [] {
+    using info = cnv::violation_info<double, cnv::predicate::positive>;
+
+    expect(info::predicate_name().ends_with("predicate::positive"));
+    expect(info{-1.0} == info{-1.0});
+  };
+
+#if defined(__cpp_lib_format)
+  test("constrained_value forwards the format spec to the underlying type") =
+      [] {
+        expect(std::format("{}", cnv::positive<int>{42}) == "42");
+        expect(std::format("{:>4}", cnv::positive<int>{42}) == "  42");
+        expect(std::format("{:.2f}", cnv::bounded<double, 0, 1>{0.5}) ==
+               "0.50");
+      };
+
+  test("violation_info formats into a stack buffer") = [] {
+    using info = cnv::violation_info<double, cnv::predicate::positive>;
+
+    auto buffer = std::array<char, 256>{};
+    const auto result = std::format_to_n(
+        buffer.data(), buffer.size(), "{:.1f}", info{-1.0});
+    const auto message = std::string_view{buffer.data(), result.out};
+
+    expect(message.ends_with("predicate::positive(-1.0) is false"));
+  };
+#endif
+
+  test("print_and_abort formats numbers as a stream does") = [] {
+    using policy = cnv::on_violation::print_and_abort;
+    const auto sl = cnv::source_location::current();
+
+    const auto streamed = [&sl](const auto& value) {
+      auto os = std::ostringstream{};
+      os << "file: " << sl.file_name() << "(" << sl.line() << ":"
+         << sl.column() << ") `" << sl.function_name() << "`: "
+         << "contract violated in `f`. p(" << value << ") is false.\n";
+      return os.str();
+    };
+    const auto formatted = [&sl](const auto& value) {
+      return std::string{
+          policy::format_message(value, "p", "f", sl).view()};
+    };
+
+    expect(streamed(-3) == formatted(-3));
+    expect(streamed(42UL) == formatted(42UL));
+    expect(streamed(1.0 / 3.0) == formatted(1.0 / 3.0));
+    expect(streamed(1e300) == formatted(1e300));
+    expect(streamed(0.5F) == formatted(0.5F));
+    expect(streamed(std::string{"abc"}) == formatted(std::string{"abc"}));
+  };
+
+  test("print_and_abort truncates long messages") = [] {
+    using policy = cnv::on_violation::print_and_abort;
+    const auto value = std::string(2 * policy::message_size, 'x');
+
+    const auto message = policy::format_message(
+        value, "p", "f", cnv::source_location::current());
+    expect(policy::message_size == message.view().size());
+  };
+
+  test("print_and_abort aborts") = [] {
+    expect(aborts([] { (void)cnv::positive<int>{0}; }));
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
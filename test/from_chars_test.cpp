@@ -0,0 +1,101 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <charconv>
+#include <iterator>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+template <typename CV, typename... Args>
+auto parse(std::string_view s, Args... args)
+{
+  return cnv::from_chars<CV>(s.data(), s.data() + s.size(), args...);
+}
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+  using kind = cnv::parse_or_violation_error::error_kind;
+
+  test("converts characters satisfying the invariant") = [] {
+    const auto x = parse<cnv::positive<int>>("42");
+
+    expect(x.has_value());
+    expect(42_i == x->value());
+
+    const auto y = parse<cnv::bounded<int, 0, 255>>("ff", 16);
+
+    expect(y.has_value());
+    expect(255_i == y->value());
+  };
+
+  test("returns an error for an invariant violation") = [] {
+    const auto s = std::string_view{"-7"};
+    const auto x = parse<cnv::positive<int>>(s);
+
+    expect(not x.has_value());
+    expect(kind::violation == x.error().kind);
+    expect(std::errc{} == x.error().ec);
+    expect(s.data() + s.size() == x.error().ptr);
+  };
+
+  test("returns an error for a parse failure") = [] {
+    const auto x = parse<cnv::positive<int>>("abc");
+
+    expect(not x.has_value());
+    expect(kind::parse == x.error().kind);
+    expect(std::errc::invalid_argument == x.error().ec);
+
+    const auto y = parse<cnv::positive<int>>("1x");
+
+    expect(not y.has_value());
+    expect(kind::parse == y.error().kind);
+    expect(std::errc::invalid_argument == y.error().ec);
+
+    const auto z = parse<cnv::positive<signed char>>("1000");
+
+    expect(not z.has_value());
+    expect(std::errc::result_out_of_range == z.error().ec);
+  };
+
+#if defined(__cpp_lib_to_chars)
+  test("converts floating point characters") = [] {
+    expect(0.5_d == parse<cnv::bounded<double, 0, 1>>("0.5")->value());
+    expect(kind::violation ==
+           parse<cnv::bounded<double, 0, 1>>("1.5").error().kind);
+    expect(kind::violation == parse<cnv::positive<double>>("nan").error().kind);
+  };
+#endif
+
+  test("converts delimited characters into a container") = [] {
+    const auto s = std::string_view{"3,1,4,1,5,"};
+    auto values = std::vector<cnv::positive<int>>{};
+
+    const auto result = cnv::from_chars_delimited<cnv::positive<int>>(
+        s.data(), s.data() + s.size(), ',', std::back_inserter(values));
+
+    expect(result.has_value());
+    expect(5_u == values.size());
+    expect(4_i == values[2].value());
+  };
+
+  test("stops converting delimited characters at the first error") = [] {
+    const auto s = std::string_view{"3 1 0 1 5"};
+    auto values = std::vector<cnv::positive<int>>{};
+
+    const auto result = cnv::from_chars_delimited<cnv::positive<int>>(
+        s.data(), s.data() + s.size(), ' ', std::back_inserter(values));
+
+    expect(not result.has_value());
+    expect(kind::violation == result.error().kind);
+    expect(2_u == values.size());
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
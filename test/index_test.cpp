@@ -0,0 +1,77 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+template <std::size_t N>
+using index_or_throw = cnv::index_for<N, throw_on_violation{}>;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("obtains the static extent of a range type") = [] {
+    static_assert(4 == cnv::static_extent_v<int[4]>);
+    static_assert(4 == cnv::static_extent_v<std::array<int, 4>>);
+    static_assert(4 == cnv::static_extent_v<std::span<int, 4>>);
+    static_assert(
+        std::dynamic_extent == cnv::static_extent_v<std::span<int>>);
+    static_assert(
+        std::dynamic_extent == cnv::static_extent_v<std::vector<int>>);
+  };
+
+  test("checks an index is in range") = [] {
+    expect(nothrow([] { index_or_throw<4>{std::size_t{3}}; }));
+    expect(throws<invalid_value_error>(
+        [] { index_or_throw<4>{std::size_t{4}}; }));
+  };
+
+  test("constrains indices to ranges with sufficient extent") = [] {
+    using I = index_or_throw<4>;
+
+    static_assert(cnv::index_of<I, std::array<int, 4>>);
+    static_assert(cnv::index_of<I, const std::array<int, 8>>);
+    static_assert(cnv::index_of<I, std::span<int, 4>>);
+    static_assert(cnv::index_of<I, int[4]>);
+    static_assert(not cnv::index_of<I, std::array<int, 3>>);
+    static_assert(not cnv::index_of<I, std::span<int>>);
+    static_assert(not cnv::index_of<I, std::vector<int>>);
+    static_assert(not cnv::index_of<cnv::bounded<int, -1, 2>, int[4]>);
+  };
+
+  test("accesses elements with a constrained index") = [] {
+    auto values = std::array{1, 2, 3, 4};
+    const auto i = index_or_throw<4>{std::size_t{2}};
+
+    expect(3_i == cnv::get(values, i));
+
+    cnv::get(values, i) = 5;
+    expect(5_i == values[2]);
+
+    const auto& view = values;
+    expect(5_i == cnv::get(view, i));
+
+    auto span = std::span{values};
+    expect(5_i == cnv::get(span, i));
+
+    static constexpr auto table = std::array{1, 4, 9, 16};
+    constexpr auto j = cnv::index_for<4>{std::size_t{2}};
+    static_assert(9 == cnv::get(table, j));
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,89 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+using unit_interval = cnv::bounded<double, 0, 1>;
+
+constinit const auto half = cnv::make_constant<unit_interval>(0.5);
+
+constexpr auto gains =
+    cnv::make_constant_array<unit_interval>(0.0, 0.25, 0.5, 1);
+
+constexpr auto squares = cnv::make_constant_array<cnv::nonnegative<int>>([] {
+  auto values = std::array<int, 16>{};
+  for (auto i = std::size_t{}; i != values.size(); ++i) {
+    values[i] = static_cast<int>(i * i);
+  }
+  return values;
+}());
+
+struct ignore_violation
+{
+  constexpr auto operator()(auto&&...) const noexcept -> void {}
+};
+
+using positive_or_ignore =
+    cnv::constrained_value<int, cnv::predicate::positive, ignore_violation>;
+
+// Checks if `make_constant_array<CV>(values...)` is a constant expression
+template <typename CV, auto... values>
+concept constant_array = requires {
+  typename std::bool_constant<
+      (cnv::make_constant_array<CV>(values...), true)>;
+};
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+  using namespace cnv::literals;
+
+  test("make_constant constructs at compile time") = [] {
+    static_assert(0.5_d == cnv::make_constant<unit_interval>(0.5));
+    expect(0.5_d == half.value());
+  };
+
+  test("make_constant_array constructs a table at compile time") = [] {
+    static_assert(4 == gains.size());
+    static_assert(0.25_d == gains[1]);
+    static_assert(1.0_d == gains[3]);
+
+    static_assert(16 == squares.size());
+    static_assert(225 == squares[15]);
+  };
+
+  test("make_constant_array rejects invalid values at compile time") = [] {
+    static_assert(constant_array<positive_or_ignore, 1, 2>);
+    static_assert(not constant_array<positive_or_ignore, 1, 0>);
+    static_assert(not constant_array<unit_interval, 0.5, 2.0>);
+  };
+
+  test("make_constant_array rejects lossy conversions") = [] {
+    static_assert(constant_array<cnv::positive<int>, 1.0, 2L>);
+    static_assert(not constant_array<cnv::positive<int>, 1.5>);
+    static_assert(not constant_array<cnv::positive<signed char>, 300>);
+    static_assert(not constant_array<cnv::positive<float>, 1e300>);
+    static_assert(constant_array<cnv::positive<float>, 0.1>);
+  };
+
+  test("literals convert to constrained values at compile time") = [] {
+    constexpr unit_interval x = 0.25_cv;
+    constexpr cnv::negative<int> y = -3_cv;
+    constexpr cnv::positive<unsigned char> z = 255_cv;
+    constexpr cnv::positive<float> w = 1.5_cv;
+
+    static_assert(0.25_d == x);
+    static_assert(-3 == y);
+    static_assert(255 == z);
+    static_assert(1.5F == w);
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,120 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+template <typename T>
+using nonnegative_or_throw = cnv::constrained_value<
+    T,
+    cnv::predicate::nonnegative,
+    decltype([](auto&&...) { throw invalid_value_error{}; })>;
+
+// Removes the file on destruction
+class temp_file
+{
+  std::filesystem::path path_;
+
+public:
+  explicit temp_file(std::filesystem::path path) : path_{std::move(path)} {}
+  temp_file(const temp_file&) = delete;
+  temp_file(temp_file&&) = delete;
+  auto operator=(const temp_file&) -> temp_file& = delete;
+  auto operator=(temp_file&&) -> temp_file& = delete;
+  ~temp_file()
+  {
+    auto ec = std::error_code{};
+    std::filesystem::remove(path_, ec);
+  }
+
+  [[nodiscard]] auto path() const -> const std::filesystem::path&
+  {
+    return path_;
+  }
+};
+
+template <typename T>
+auto write_file(const char* name, std::span<const T> values) -> temp_file
+{
+  auto path = std::filesystem::temp_directory_path() /
+              (std::string{"mapped_array_test_"} + name);
+  auto file = std::ofstream{path, std::ios::binary | std::ios::trunc};
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  file.write(reinterpret_cast<const char*>(values.data()),
+             static_cast<std::streamsize>(values.size_bytes()));
+  return temp_file{std::move(path)};
+}
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  static_assert(
+      cnv::layout_compatible_with_underlying<cnv::nonnegative<double>>);
+  static_assert(
+      cnv::layout_compatible_with_underlying<cnv::bounded<float, 0, 1>>);
+
+  test("maps a file of valid values") = [] {
+    const auto values = std::vector<double>{0.0, 1.0, 2.5, 1e300};
+    const auto file = write_file<double>("valid.bin", values);
+
+    const auto mapped =
+        cnv::mapped_array<cnv::nonnegative<double>>{file.path()};
+
+    expect(values.size() == mapped.size());
+    for (auto i = std::size_t{}; i != values.size(); ++i) {
+      expect(values[i] == mapped[i].value());
+    }
+  };
+
+  test("maps an empty file") = [] {
+    const auto file = write_file<float>("empty.bin", {});
+
+    const auto mapped =
+        cnv::mapped_array<cnv::bounded<float, 0, 1>>{file.path()};
+
+    expect(mapped.empty());
+    expect(mapped.span().empty());
+  };
+
+  test("invokes violation policy for an invalid value") = [] {
+    auto values = std::vector<double>(100'000, 1.0);
+    values.back() = -1.0;
+    const auto file = write_file<double>("invalid.bin", values);
+
+    expect(throws<invalid_value_error>([&] {
+      (void)cnv::mapped_array<nonnegative_or_throw<double>>{file.path()};
+    }));
+    expect(aborts([&] {
+      (void)cnv::mapped_array<cnv::nonnegative<double>>{file.path()};
+    }));
+  };
+
+  test("throws if the file cannot be mapped") = [] {
+    expect(throws<std::system_error>([] {
+      (void)cnv::mapped_array<cnv::nonnegative<double>>{"/does/not/exist"};
+    }));
+
+    const auto values = std::vector<float>{1.0F, 2.0F, 3.0F};
+    const auto file = write_file<float>("truncated.bin", values);
+
+    expect(throws<std::system_error>([&] {
+      (void)cnv::mapped_array<cnv::nonnegative<double>>{file.path()};
+    }));
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,113 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <string_view>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+struct counted_identifier
+{
+  static inline auto calls = 0;
+
+  constexpr auto operator()(std::string_view s) const -> bool
+  {
+    if (not std::is_constant_evaluated()) {
+      ++calls;
+    }
+
+    const auto head = [](char c) {
+      return std::isalpha(static_cast<unsigned char>(c)) != 0 or c == '_';
+    };
+    const auto tail = [&head](char c) {
+      return head(c) or std::isdigit(static_cast<unsigned char>(c)) != 0;
+    };
+
+    return not s.empty() and head(s.front()) and
+           std::all_of(s.begin() + 1, s.end(), tail);
+  }
+};
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("evaluates the predicate once for a repeated argument") = [] {
+    using identifier = cnv::functional::memoize<counted_identifier>;
+
+    counted_identifier::calls = 0;
+
+    expect(identifier{}(std::string_view{"x_1"}));
+    expect(identifier{}(std::string_view{"x_1"}));
+    expect(not identifier{}(std::string_view{"1x"}));
+    expect(not identifier{}(std::string_view{"1x"}));
+
+    expect(2_i == counted_identifier::calls);
+  };
+
+  test("replaces a cached result on a collision") = [] {
+    using identifier = cnv::functional::memoize<counted_identifier, 1>;
+
+    counted_identifier::calls = 0;
+
+    expect(identifier{}(std::string_view{"a"}));
+    expect(not identifier{}(std::string_view{"0"}));
+    expect(identifier{}(std::string_view{"a"}));
+
+    expect(3_i == counted_identifier::calls);
+  };
+
+  test("caches a copy of a viewed argument") = [] {
+    using identifier = cnv::functional::memoize<counted_identifier>;
+
+    auto buffer = std::string{"abc"};
+    expect(identifier{}(std::string_view{buffer}));
+
+    buffer[0] = '0';
+    expect(not identifier{}(std::string_view{buffer}));
+  };
+
+  test("evaluates a long viewed argument without caching it") = [] {
+    using identifier = cnv::functional::memoize<counted_identifier>;
+
+    const auto buffer = std::string(100, 'x');
+
+    counted_identifier::calls = 0;
+
+    expect(identifier{}(std::string_view{buffer}));
+    expect(identifier{}(std::string_view{buffer}));
+    expect(identifier{}(std::string_view{buffer}.substr(0, 32)));
+    expect(identifier{}(std::string_view{buffer}.substr(0, 32)));
+
+    expect(3_i == counted_identifier::calls);
+  };
+
+  test("checks an invariant") = [] {
+    using identifier = cnv::constrained_value<
+        std::string_view,
+        cnv::functional::memoize<counted_identifier>,
+        throw_on_violation>;
+
+    expect(nothrow([] { identifier{std::string_view{"key"}}; }));
+    expect(throws<invalid_value_error>(
+        [] { identifier{std::string_view{"no key"}}; }));
+  };
+
+  test("evaluates the predicate during constant evaluation") = [] {
+    static_assert(cnv::functional::memoize<cnv::predicate::positive>{}(1));
+    static_assert(not cnv::functional::memoize<cnv::predicate::positive>{}(0));
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,89 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("has the size of the underlying type") = [] {
+    static_assert(sizeof(cnv::optional<cnv::positive<int>>) == sizeof(int));
+    static_assert(
+        sizeof(cnv::optional<cnv::bounded<double, 0, 1>>) == sizeof(double));
+    static_assert(
+        sizeof(cnv::optional<cnv::bounded<unsigned char, 1, 255>>) == 1);
+  };
+
+  test("requires a value that does not satisfy the invariant") = [] {
+    static_assert(cnv::has_sentinel<cnv::positive<int>>);
+    static_assert(cnv::has_sentinel<cnv::nonnegative<int>>);
+    static_assert(cnv::has_sentinel<cnv::positive<unsigned>>);
+    static_assert(not cnv::has_sentinel<cnv::nonnegative<unsigned>>);
+  };
+
+  test("is empty by default") = [] {
+    constexpr auto x = cnv::optional<cnv::positive<int>>{};
+    static_assert(not x.has_value());
+    static_assert(x == std::nullopt);
+
+    const auto y = cnv::optional<cnv::bounded<double, 0, 1>>{std::nullopt};
+    expect(not y);
+    expect(throws<std::bad_optional_access>([&y] { (void)y.value(); }));
+  };
+
+  test("contains a value") = [] {
+    constexpr auto x = cnv::optional<cnv::positive<int>>{3};
+    static_assert(x.has_value());
+    static_assert((*x).value() == 3);
+
+    auto y = cnv::optional<cnv::bounded<double, 0, 1>>{};
+    y = cnv::bounded<double, 0, 1>{0.5};
+    expect(y.has_value());
+    expect(0.5_d == y.value().value());
+
+    y.reset();
+    expect(not y.has_value());
+    expect(0.25_d == y.value_or(cnv::bounded<double, 0, 1>{0.25}).value());
+  };
+
+  test("prefers NaN as the sentinel of floating point values") = [] {
+    auto values = std::vector<cnv::optional<cnv::positive<double>>>(3);
+    values[1] = cnv::positive<double>{1.0};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* const raw = reinterpret_cast<const double*>(values.data());
+    expect(std::isnan(raw[0]));
+    expect(1.0_d == raw[1]);
+  };
+
+  test("uses another sentinel if NaN satisfies the invariant") = [] {
+    // `std::ranges::less_equal` and `std::ranges::greater_equal` are
+    // implemented with `not (x < y)`, which is satisfied by NaN
+    const auto x = cnv::optional<cnv::bounded<double, 0, 1>>{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto raw = *reinterpret_cast<const double*>(&x);
+    expect(std::isinf(raw));
+    expect(not x.has_value());
+  };
+
+  test("compares values") = [] {
+    using opt = cnv::optional<cnv::positive<int>>;
+
+    static_assert(opt{} == opt{});
+    static_assert(opt{1} == opt{1});
+    static_assert(opt{1} != opt{2});
+    static_assert(opt{1} != opt{});
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,109 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+template <typename CV>
+constexpr auto packed_bits = cnv::packed_array<CV>::bits_per_value;
+
+template <typename T>
+auto iota(std::size_t n, T lo, T hi) -> std::vector<T>
+{
+  auto values = std::vector<T>(n);
+  auto x = lo;
+  for (auto& value : values) {
+    value = x;
+    x = (x == hi) ? lo : static_cast<T>(x + 1);
+  }
+  return values;
+}
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("derives the bounds of a bounded predicate") = [] {
+    using P = cnv::bounded<int, -3, 12>::predicate_type;
+
+    static_assert(cnv::bounds_of<P>::lower == -3);
+    static_assert(cnv::bounds_of<P>::upper == 12);
+    static_assert(cnv::bounded_value<cnv::bounded<int, -3, 12>>);
+    static_assert(not cnv::bounded_value<cnv::positive<int>>);
+  };
+
+  test("uses the minimal number of bits") = [] {
+    static_assert(packed_bits<cnv::bounded<int, 0, 15>> == 4);
+    static_assert(packed_bits<cnv::bounded<int, 0, 16>> == 5);
+    static_assert(packed_bits<cnv::bounded<int, -8, 7>> == 4);
+    static_assert(packed_bits<cnv::bounded<int, 3, 3>> == 1);
+    static_assert(
+        packed_bits<cnv::bounded<
+            std::int64_t,
+            std::numeric_limits<std::int64_t>::min(),
+            std::numeric_limits<std::int64_t>::max()>> == 64);
+  };
+
+  test("appends and accesses values") = [] {
+    auto values = cnv::packed_array<cnv::bounded<int, -8, 7>>{};
+
+    for (auto x = -8; x != 8; ++x) {
+      values.push_back(x);
+    }
+
+    expect(16_u == values.size());
+    expect(1_u == values.words().size());
+    for (auto i = 0U; i != 16U; ++i) {
+      expect(values[i].value() == static_cast<int>(i) - 8);
+    }
+
+    values.set(3, 6);
+    expect(6_i == values[3].value());
+    expect(-6_i == values[2].value());
+    expect(-4_i == values[4].value());
+  };
+
+  test("packs and unpacks values in bulk") = [] {
+    const auto raw = iota<int>(1'001, -3, 20);
+
+    auto values = cnv::packed_array<cnv::bounded<int, -3, 20>>{};
+    values.push_back(1);
+    values.append(raw);
+
+    expect(1'002_u == values.size());
+    expect(1_i == values[0].value());
+    expect(20_i == values[24].value());
+
+    auto out = std::vector<int>(values.size());
+    values.unpack(out);
+
+    expect(1_i == out[0]);
+    expect(std::equal(raw.begin(), raw.end(), out.begin() + 1));
+  };
+
+  test("does not append values that violate the invariant") = [] {
+    auto raw = iota<int>(100, 0, 9);
+    raw[50] = 10;
+
+    auto values =
+        cnv::packed_array<cnv::bounded<int, 0, 9, throw_on_violation{}>>{};
+
+    expect(throws<invalid_value_error>([&] { values.append(raw); }));
+    expect(values.empty());
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
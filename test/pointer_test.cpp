@@ -0,0 +1,85 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+// NOLINTBEGIN(readability-magic-numbers)
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+template <typename T, std::size_t N>
+using aligned_or_throw = cnv::aligned_ptr<T, N, throw_on_violation{}>;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("checks pointers are not null") = [] {
+    static constexpr auto x = 0;
+
+    static_assert(cnv::predicate::not_null{}(&x));
+    static_assert(not cnv::predicate::not_null{}(static_cast<int*>(nullptr)));
+
+    expect(cnv::predicate::not_null{}(std::make_unique<int>()));
+    expect(not cnv::predicate::not_null{}(std::shared_ptr<int>{}));
+  };
+
+  test("checks pointers are aligned") = [] {
+    alignas(64) auto buffer = std::array<float, 32>{};
+
+    expect(cnv::predicate::aligned<64>{}(buffer.data()));
+    expect(cnv::predicate::aligned<16>{}(buffer.data() + 4));
+    expect(not cnv::predicate::aligned<64>{}(buffer.data() + 4));
+    expect(cnv::predicate::aligned<64>{}(static_cast<float*>(nullptr)));
+  };
+
+  test("obtains the alignment guaranteed by a predicate") = [] {
+    using P = aligned_or_throw<float, 64>::predicate_type;
+
+    static_assert(64 == cnv::alignment_of<P>::value);
+    static_assert(cnv::excludes_null_v<P>);
+
+    static_assert(1 == cnv::alignment_of<cnv::predicate::not_null>::value);
+    static_assert(not cnv::excludes_null_v<cnv::predicate::aligned<16>>);
+  };
+
+  test("checks an invariant") = [] {
+    alignas(64) static auto buffer = std::array<float, 32>{};
+
+    expect(nothrow([] { aligned_or_throw<float, 64>{buffer.data()}; }));
+    expect(throws<invalid_value_error>(
+        [] { aligned_or_throw<float, 64>{buffer.data() + 1}; }));
+    expect(throws<invalid_value_error>(
+        [] { aligned_or_throw<float, 64>{static_cast<float*>(nullptr)}; }));
+  };
+
+  test("reads through an aligned pointer") = [] {
+    alignas(64) auto buffer = std::array<float, 32>{};
+    buffer.fill(2.0F);
+
+    const auto data = cnv::aligned_ptr<const float, 64>{
+        static_cast<const float*>(buffer.data())};
+    const auto* p = cnv::assume_aligned(data);
+
+    expect(p == buffer.data());
+
+    auto sum = 0.0F;
+    for (auto i = std::size_t{}; i != buffer.size(); ++i) {
+      sum += p[i];
+    }
+    expect(64.0_f == sum);
+  };
+}
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,121 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using positive_or_throw = cnv::constrained_value<
+    int,
+    cnv::predicate::positive,
+    decltype([](auto&&...) { throw invalid_value_error{}; })>;
+
+auto find_line(std::uint_least32_t line) -> cnv::profile::counters
+{
+  const auto entries = cnv::profile::snapshot();
+  const auto it = std::ranges::find_if(entries, [line](const auto& e) {
+    return e.site.line == line;
+  });
+  return (it == entries.end()) ? cnv::profile::counters{} : it->count;
+}
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("records checks per call site") = [] {
+    const auto line = cnv::source_location::current().line() + 2;
+    for (auto i = 0; i != 10; ++i) {
+      (void)cnv::positive<int>{i + 1};
+    }
+
+    const auto count = find_line(line);
+    expect(10_u == count.checks);
+    expect(0_u == count.failures);
+  };
+
+  test("records failed checks") = [] {
+    const auto line = cnv::source_location::current().line() + 3;
+    for (auto i = 0; i != 4; ++i) {
+      try {
+        (void)positive_or_throw{i};
+      } catch (const invalid_value_error&) {
+      }
+    }
+
+    const auto count = find_line(line);
+    expect(4_u == count.checks);
+    expect(1_u == count.failures);
+  };
+
+  test("aggregates checks from other threads") = [] {
+    const auto line = cnv::source_location::current().line() + 3;
+    auto t = std::thread{[] {
+      for (auto i = 0; i != 5; ++i) {
+        (void)cnv::positive<int>{i + 1};
+      }
+    }};
+    t.join();
+
+    expect(5_u == find_line(line).checks);
+  };
+
+  test("reports while other threads record checks") = [] {
+    const auto line = cnv::source_location::current().line() + 4;
+    auto done = std::atomic<bool>{};
+    auto t = std::thread{[&done] {
+      do {
+        (void)cnv::positive<int>{1};
+      } while (not done.load());
+    }};
+
+    for (auto i = 0; i != 100; ++i) {
+      (void)cnv::profile::snapshot();
+    }
+    done = true;
+    t.join();
+
+    expect(find_line(line).checks >= 1_u);
+  };
+
+  test("registers threads concurrently") = [] {
+    const auto line = cnv::source_location::current().line() + 4;
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0; i != 8; ++i) {
+      threads.emplace_back([] {
+        (void)cnv::positive<int>{1};
+        (void)cnv::profile::snapshot();
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+
+    expect(8_u == find_line(line).checks);
+  };
+
+  test("does not record checks during constant evaluation") = [] {
+    static constexpr auto x = cnv::positive<int>{1};
+    expect(1_i == x.value());
+  };
+
+  test("writes a report") = [] {
+    auto os = std::ostringstream{};
+    cnv::profile::report(os);
+
+    expect(os.str().find("profile_test.cpp") != std::string::npos);
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
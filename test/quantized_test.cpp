@@ -0,0 +1,96 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+using gain = cnv::quantized<cnv::bounded<float, 0, 1, throw_on_violation{}>>;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("uses the size of the code type") = [] {
+    static_assert(sizeof(gain) == sizeof(std::uint16_t));
+    static_assert(
+        sizeof(cnv::quantized<cnv::bounded<double, -1, 1>, std::uint32_t>) ==
+        sizeof(std::uint32_t));
+  };
+
+  test("represents the bounds exactly") = [] {
+    static_assert(gain{0.0F}.value() == 0.0F);
+    static_assert(gain{1.0F}.value() == 1.0F);
+    static_assert(gain{0.0F}.code() == 0);
+    static_assert(gain{1.0F}.code() == 65535);
+
+    using Q = cnv::quantized<cnv::bounded<double, -3, 7>, std::uint8_t, 4>;
+    static_assert(Q{-3.0}.value() == -3.0);
+    static_assert(Q{7.0}.value() == 7.0);
+    static_assert(Q{7.0}.code() == 15);
+  };
+
+  test("rounds to the nearest code") = [] {
+    for (auto x = 0.0F; x <= 1.0F; x += 0.001F) {
+      const auto q = gain{x};
+      expect(std::abs(q.value() - x) <= gain::resolution / 2.0F);
+    }
+  };
+
+  test("invokes the violation policy for values outside the bounds") = [] {
+    expect(throws<invalid_value_error>([] { (void)gain{1.5F}; }));
+    expect(throws<invalid_value_error>([] { (void)gain{-0.1F}; }));
+  };
+
+  test("compares codes") = [] {
+    static_assert(gain{0.25F} < gain{0.5F});
+    static_assert(gain{0.5F} == gain{0.5F});
+  };
+
+  test("converts to the constrained value") = [] {
+    const cnv::bounded<float, 0, 1, throw_on_violation{}> x = gain{1.0F};
+    expect(1.0_f == x.value());
+  };
+
+  test("encodes and decodes values in bulk") = [] {
+    auto values = std::vector<float>(1'000);
+    for (auto i = 0U; i != values.size(); ++i) {
+      values[i] = static_cast<float>(i) / 999.0F;
+    }
+
+    auto codes = std::vector<gain>(values.size());
+    gain::encode_all(values, codes);
+
+    auto decoded = std::vector<float>(values.size());
+    gain::decode_all(codes, decoded);
+
+    for (auto i = 0U; i != values.size(); ++i) {
+      expect(codes[i].code() == gain{values[i]}.code());
+      expect(std::abs(decoded[i] - values[i]) <= gain::resolution / 2.0F);
+    }
+  };
+
+  test("does not encode values that violate the invariant") = [] {
+    auto values = std::vector<float>(100, 0.5F);
+    values[70] = 2.0F;
+
+    auto codes = std::vector<gain>(values.size());
+
+    expect(throws<invalid_value_error>(
+        [&] { gain::encode_all(values, codes); }));
+    expect(0_u == codes[0].code());
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,146 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+template <cnv::fixed_string pattern>
+constexpr auto matches(std::string_view str) -> bool
+{
+  return cnv::predicate::matches<pattern>{}(str);
+}
+
+template <cnv::fixed_string pattern>
+concept valid_pattern = requires {
+  typename std::bool_constant<(
+      cnv::detail::regex::parser{pattern.view()}.parse(), true)>;
+};
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("matches literals") = [] {
+    static_assert(matches<"">(""));
+    static_assert(not matches<"">("a"));
+    static_assert(matches<"abc">("abc"));
+    static_assert(not matches<"abc">("ab"));
+    static_assert(not matches<"abc">("abcd"));
+    static_assert(matches<"a\\.b">("a.b"));
+    static_assert(not matches<"a\\.b">("axb"));
+  };
+
+  test("matches any character") = [] {
+    static_assert(matches<"a.c">("abc"));
+    static_assert(matches<"a.c">("a.c"));
+    static_assert(not matches<"a.c">("a\nc"));
+  };
+
+  test("matches bracket expressions") = [] {
+    static_assert(matches<"[a-c_]">("b"));
+    static_assert(matches<"[a-c_]">("_"));
+    static_assert(not matches<"[a-c_]">("d"));
+    static_assert(matches<"[^0-9]">("x"));
+    static_assert(not matches<"[^0-9]">("5"));
+    static_assert(matches<"[\\]a]">("]"));
+    static_assert(matches<"[\\]a]">("a"));
+    static_assert(matches<"[a-]">("-"));
+    static_assert(matches<"[\\d.]">("."));
+    static_assert(matches<"[\\d.]">("7"));
+  };
+
+  test("matches escaped character classes") = [] {
+    static_assert(matches<"\\d\\w\\s">("1_ "));
+    static_assert(not matches<"\\d">("a"));
+    static_assert(matches<"\\D\\W\\S">("a-b"));
+    static_assert(not matches<"\\S">("\t"));
+  };
+
+  test("matches escaped metacharacters") = [] {
+    static_assert(matches<"\\^\\$\\\\\\.\\*\\+\\?">("^$\\.*+?"));
+    static_assert(matches<"\\(\\)\\[\\]\\{\\}\\|\\/\\-">("()[]{}|/-"));
+    static_assert(matches<"[\\-\\\\]+">("-\\"));
+  };
+
+  test("rejects unsupported escapes") = [] {
+    static_assert(valid_pattern<"a\\.b">);
+    static_assert(not valid_pattern<"\\b">);
+    static_assert(not valid_pattern<"\\x41">);
+    static_assert(not valid_pattern<"(a)\\1">);
+    static_assert(not valid_pattern<"\\a">);
+    static_assert(not valid_pattern<"[\\b]">);
+    static_assert(not valid_pattern<"\\">);
+  };
+
+  test("matches alternation and groups") = [] {
+    static_assert(matches<"cat|dog">("cat"));
+    static_assert(matches<"cat|dog">("dog"));
+    static_assert(not matches<"cat|dog">("cow"));
+    static_assert(matches<"(ab|cd)e">("cde"));
+    static_assert(not matches<"(ab|cd)e">("abcde"));
+    static_assert(matches<"a()b">("ab"));
+  };
+
+  test("matches quantifiers") = [] {
+    static_assert(matches<"ab*c">("ac"));
+    static_assert(matches<"ab*c">("abbbc"));
+    static_assert(not matches<"ab+c">("ac"));
+    static_assert(matches<"ab+c">("abc"));
+    static_assert(matches<"ab?c">("ac"));
+    static_assert(not matches<"ab?c">("abbc"));
+    static_assert(matches<"(ab)*">("ababab"));
+    static_assert(not matches<"(ab)*">("aba"));
+  };
+
+  test("matches bounded repetition") = [] {
+    static_assert(matches<"a{3}">("aaa"));
+    static_assert(not matches<"a{3}">("aa"));
+    static_assert(not matches<"a{3}">("aaaa"));
+    static_assert(matches<"a{2,}">("aaaaa"));
+    static_assert(not matches<"a{2,}">("a"));
+    static_assert(matches<"a{1,3}">("aa"));
+    static_assert(not matches<"a{1,3}">(""));
+    static_assert(not matches<"a{1,3}">("aaaa"));
+    static_assert(matches<"(a|bc){2}">("bca"));
+    static_assert(matches<"x{0}">(""));
+    static_assert(matches<"a*{2}b">("aab"));
+  };
+
+  test("matches identifiers at run time") = [] {
+    using identifier = cnv::predicate::matches<"[a-z_][a-z0-9_]{0,63}">;
+
+    const auto valid = std::string{"snake_case_1"};
+    const auto invalid = std::string{"1_leading_digit"};
+    const auto too_long = std::string(65, 'x');
+
+    expect(identifier{}(valid));
+    expect(not identifier{}(invalid));
+    expect(identifier{}(std::string_view{too_long}.substr(1)));
+    expect(not identifier{}(too_long));
+  };
+
+  test("checks an invariant") = [] {
+    using key = cnv::constrained_value<
+        std::string_view,
+        cnv::predicate::matches<"[a-z]+(\\.[a-z]+)*">,
+        throw_on_violation>;
+
+    expect(nothrow([] { key{std::string_view{"log.level"}}; }));
+    expect(throws<invalid_value_error>(
+        [] { key{std::string_view{"log..level"}}; }));
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
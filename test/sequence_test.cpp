@@ -0,0 +1,115 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("checks the difference of adjacent values") = [] {
+    using cnv::predicate::delta_at_most;
+
+    static_assert(delta_at_most<2>{}(10, 12));
+    static_assert(delta_at_most<2>{}(12, 10));
+    static_assert(not delta_at_most<2>{}(10, 13));
+    static_assert(not delta_at_most<2>{}(13, 10));
+
+    constexpr auto min = std::numeric_limits<std::int8_t>::min();
+    constexpr auto max = std::numeric_limits<std::int8_t>::max();
+    static_assert(delta_at_most<255>{}(min, max));
+    static_assert(not delta_at_most<254>{}(min, max));
+
+    static_assert(delta_at_most<0.5>{}(1.0, 1.5));
+    static_assert(not delta_at_most<0.5>{}(1.0, 1.6));
+    static_assert(not delta_at_most<0.5>{}(
+        1.0, std::numeric_limits<double>::quiet_NaN()));
+  };
+
+  test("checks adjacent elements of a range") = [] {
+    using cnv::predicate::adjacent;
+    using cnv::predicate::delta_at_most;
+    using cnv::predicate::less;
+
+    static_assert(adjacent<less>{}(std::array<int, 0>{}));
+    static_assert(adjacent<less>{}(std::array{1}));
+    static_assert(adjacent<less>{}(std::array{1, 2, 4}));
+    static_assert(not adjacent<less>{}(std::array{1, 2, 2}));
+    static_assert(adjacent<delta_at_most<2>>{}(std::array{1, 3, 2}));
+    static_assert(not adjacent<delta_at_most<1>>{}(std::array{1, 2, 4}));
+  };
+
+  test("checks adjacent elements across blocks") = [] {
+    using cnv::predicate::adjacent;
+    using cnv::predicate::less;
+
+    auto values = std::vector<int>(1000);
+    std::iota(values.begin(), values.end(), 0);
+    expect(adjacent<less>{}(values));
+
+    const auto positions = std::array<std::size_t, 6>{1, 63, 64, 65, 500, 999};
+    for (const auto i : positions) {
+      auto invalid = values;
+      invalid[i] = invalid[i - 1];
+      expect(not adjacent<less>{}(invalid)) << i;
+    }
+  };
+
+  test("constrains a range with an adjacent predicate") = [] {
+    using increasing = cnv::constrained_value<
+        std::vector<int>,
+        cnv::predicate::adjacent<cnv::predicate::less>,
+        decltype([](auto&&...) { throw invalid_value_error{}; })>;
+
+    expect(nothrow([] { increasing{std::vector{1, 2, 3}}; }));
+    expect(throws<invalid_value_error>(
+        [] { increasing{std::vector{1, 3, 2}}; }));
+  };
+
+  test("checks a sequence across batches") = [] {
+    auto checker = cnv::sequence_checker<std::int64_t, cnv::predicate::less>{};
+
+    expect(not checker.previous().has_value());
+
+    expect(checker.push(std::vector<std::int64_t>{1, 2, 3}));
+    expect(*checker.previous() == 3);
+
+    expect(checker.push(std::vector<std::int64_t>{}));
+    expect(*checker.previous() == 3);
+
+    expect(not checker.valid(std::vector<std::int64_t>{3, 4}));
+    expect(not checker.push(std::vector<std::int64_t>{3, 4}));
+    expect(*checker.previous() == 3);
+
+    expect(not checker.push(std::vector<std::int64_t>{4, 6, 5}));
+    expect(*checker.previous() == 3);
+
+    expect(checker.push(std::vector<std::int64_t>{4, 6}));
+    expect(*checker.previous() == 6);
+  };
+
+  test("checks a sequence from an initial value") = [] {
+    auto checker =
+        cnv::sequence_checker<double, cnv::predicate::delta_at_most<1.0>>{
+            10.0};
+
+    expect(checker.push(std::array{10.5, 11.0, 10.0}));
+    expect(not checker.push(std::array{11.5}));
+    expect(10.0_d == *checker.previous());
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
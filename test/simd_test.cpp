@@ -0,0 +1,100 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <limits>
+#include <span>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("checks all values satisfy a predicate") = [] {
+    auto values = std::vector<double>(1'001, 1.0);
+
+    expect(cnv::all_satisfy<cnv::predicate::positive>(
+        std::span<const double>{values}));
+
+    values.back() = 0.0;
+    expect(not cnv::all_satisfy<cnv::predicate::positive>(
+        std::span<const double>{values}));
+
+    values.back() = 1.0;
+    values.front() = -1.0;
+    expect(not cnv::all_satisfy<cnv::predicate::positive>(
+        std::span<const double>{values}));
+  };
+
+  test("checks NaN values as the scalar predicate does") = [] {
+    using unit_interval = cnv::bounded<double, 0, 1>::predicate_type;
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    const auto expected = unit_interval{}(nan);
+
+    for (const auto n : {3UL, 8UL, 9UL}) {
+      for (auto i = 0UL; i != n; ++i) {
+        auto values = std::vector<double>(n, 0.5);
+        values[i] = nan;
+        expect(
+            expected == cnv::all_satisfy<unit_interval>(
+                            std::span<const double>{values}))
+            << "size" << n << "index" << i;
+      }
+    }
+  };
+
+#if defined(__cpp_lib_experimental_parallel_simd)
+  namespace stdx = std::experimental;
+  using lanes = stdx::native_simd<double>;
+
+  const auto iota = lanes{[](auto i) { return static_cast<double>(i) - 1.0; }};
+
+  test("comparison predicates return masks") = [&iota] {
+    const auto positive = cnv::predicate::positive{}(iota);
+    const auto nonpositive = cnv::predicate::nonpositive{}(iota);
+
+    static_assert(std::is_same_v<decltype(positive), const lanes::mask_type>);
+    expect(stdx::none_of(positive and nonpositive));
+    expect(stdx::all_of(positive or nonpositive));
+    expect(not positive[0]);
+    expect(not positive[1]);
+    expect(nonpositive[0]);
+    expect(nonpositive[1]);
+  };
+
+  test("composed predicates return masks") = [&iota] {
+    using bounded = cnv::bounded<double, -1, 8>::predicate_type;
+    expect(stdx::all_of(bounded{}(iota)));
+
+    using unit = cnv::functional::compose<
+        cnv::projection::abs,
+        cnv::predicate::equal_to::bind_back<1>>;
+    const auto is_unit = unit{}(iota);
+    expect(is_unit[0]);
+    expect(not is_unit[1]);
+  };
+
+  test("math functions return lanes") = [&iota] {
+    expect(stdx::all_of(cnv::math::abs(iota) >= 0.0));
+    expect(stdx::all_of(cnv::math::isfinite(iota)));
+    expect(not stdx::all_of(
+        cnv::math::isfinite(iota / lanes{0.0} + lanes{1.0})));
+  };
+
+  test("predicates are lanewise") = [] {
+    static_assert(cnv::lanewise_predicate<cnv::predicate::positive, double>);
+    static_assert(cnv::lanewise_predicate<
+                  cnv::bounded<int, 0, 10>::predicate_type,
+                  int>);
+    static_assert(not cnv::lanewise_predicate<
+                  decltype([](double x) { return x > 0; }),
+                  double>);
+  };
+#endif
+}
+
+// NOLINTEND(readability-magic-numbers)
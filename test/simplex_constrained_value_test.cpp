@@ -0,0 +1,79 @@
+#include "constrained_value/constrained_value.hpp"
+#include "utility.hpp"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+auto main() -> int
+{
+  namespace cnv = ::constrained_value;
+  using namespace cnv::test;
+  using namespace ::boost::ut;
+
+  test("simplex constrained_value") = [] {
+    constexpr_valid<cnv::simplex>(std::array{1.0});
+    constexpr_valid<cnv::simplex>(std::array{0.25, 0.75});
+    constexpr_valid<cnv::simplex>(std::array{0.0F, 0.5F, 0.5F});
+
+    valid<cnv::simplex, cnv::constant::ulp<4>>(std::vector(10, 0.1));
+
+    invalid<cnv::simplex>(std::array<double, 0>{});
+    invalid<cnv::simplex>(std::array{0.5, 0.25});
+    invalid<cnv::simplex>(std::array{0.5, 0.75, -0.25});
+    invalid<cnv::simplex>(
+        std::array{1.0, std::numeric_limits<double>::quiet_NaN()});
+  };
+
+  test("simplex tolerance") = [] {
+    using cnv::constant::ulp;
+
+    constexpr auto eps = std::numeric_limits<double>::epsilon();
+
+    static_assert(cnv::predicate::simplex<ulp<2>>{}(std::array{1.0 + 2 * eps}));
+    static_assert(
+        not cnv::predicate::simplex<ulp<2>>{}(std::array{1.0 + 3 * eps}));
+    static_assert(
+        cnv::predicate::simplex<ulp<2>>{}(std::array{1.0 - eps, 0.0}));
+    static_assert(
+        not cnv::predicate::simplex<ulp<0>>{}(std::array{1.0 - eps / 2}));
+  };
+
+  test("simplex sums long vectors accurately") = [] {
+    using cnv::constant::ulp;
+
+    constexpr auto n = 1'000'003;
+
+    auto values = std::vector<float>(n, 1.0F / static_cast<float>(n));
+    static_cast<void>(cnv::renormalize_simplex<ulp<16>>(std::span{values}));
+
+    expect(cnv::predicate::simplex<ulp<16>>{}(values));
+
+    // a sequential sum in single precision accumulates an error of many ULP
+    const auto sum = std::accumulate(values.begin(), values.end(), 0.0F);
+    expect(std::abs(sum - 1.0F) > 1e-4F);
+  };
+
+  test("renormalize a probability vector") = [] {
+    auto values = std::vector{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+
+    expect(cnv::renormalize_simplex(std::span{values}));
+    expect(cnv::predicate::simplex<>{}(values));
+    expect(not cnv::renormalize_simplex(std::span{values}));
+
+    auto weights = std::vector<double>(1'000);
+    std::iota(weights.begin(), weights.end(), 1.0);
+
+    expect(cnv::renormalize_simplex(std::span{weights}));
+    expect(cnv::predicate::simplex<>{}(weights));
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
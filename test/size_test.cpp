@@ -0,0 +1,106 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+template <std::size_t N>
+using block_span = cnv::constrained_value<
+    std::span<const float>,
+    cnv::predicate::size_multiple_of<N>,
+    throw_on_violation>;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("checks an integer is a multiple of another") = [] {
+    static_assert(cnv::predicate::multiple_of{}(12, 4));
+    static_assert(not cnv::predicate::multiple_of{}(12, 5));
+    static_assert(cnv::predicate::multiple_of::bind_back<4>{}(0));
+    static_assert(not cnv::predicate::multiple_of::bind_back<4>{}(6));
+  };
+
+  test("checks multiples of zero and minus one") = [] {
+    constexpr auto min = std::numeric_limits<int>::min();
+
+    static_assert(cnv::predicate::multiple_of{}(0, 0));
+    static_assert(not cnv::predicate::multiple_of{}(5, 0));
+    static_assert(cnv::predicate::multiple_of{}(min, -1));
+    static_assert(cnv::predicate::multiple_of{}(min, min));
+    static_assert(cnv::predicate::multiple_of{}(0U, 0U));
+
+    auto divisor = 0;
+    expect(not cnv::predicate::multiple_of{}(7, divisor));
+    divisor = -1;
+    expect(cnv::predicate::multiple_of{}(min, divisor));
+  };
+
+  test("checks the number of elements of a range") = [] {
+    using multiple = cnv::predicate::size_multiple_of<4>;
+    using at_least = cnv::predicate::size_at_least<2>;
+
+    static_assert(multiple{}(std::array<int, 0>{}));
+    static_assert(multiple{}(std::array<int, 8>{}));
+    static_assert(not multiple{}(std::array<int, 6>{}));
+
+    static_assert(not at_least{}(std::array<int, 1>{}));
+    static_assert(at_least{}(std::array<int, 2>{}));
+
+    expect(multiple{}(std::vector<int>(12)));
+    expect(not at_least{}(std::vector<int>{}));
+  };
+
+  test("obtains the size invariant of a predicate") = [] {
+    using P = cnv::functional::all_of<
+        cnv::predicate::size_multiple_of<4>,
+        cnv::predicate::size_multiple_of<6>,
+        cnv::predicate::size_at_least<24>>;
+
+    static_assert(12 == cnv::size_granularity_of<P>::value);
+    static_assert(24 == cnv::min_size_of<P>::value);
+
+    static_assert(1 == cnv::size_granularity_of<cnv::predicate::ascii>::value);
+    static_assert(0 == cnv::min_size_of<cnv::predicate::ascii>::value);
+  };
+
+  test("checks an invariant") = [] {
+    static const auto values = std::vector<float>(20, 1.0F);
+
+    expect(nothrow([] { block_span<4>{std::span{values}}; }));
+    expect(throws<invalid_value_error>(
+        [] { block_span<8>{std::span{values}}; }));
+  };
+
+  test("reads through a constrained range") = [] {
+    const auto values = std::vector<float>(32, 0.5F);
+    const auto data = block_span<16>{std::span{values}};
+
+    const auto& blocks = cnv::assume_size(data);
+    expect(32_u == blocks.size());
+
+    auto sum = 0.0F;
+    for (auto i = std::size_t{}; i != blocks.size(); i += 16) {
+      for (auto j = std::size_t{}; j != 16; ++j) {
+        sum += blocks[i + j];
+      }
+    }
+    expect(16.0_f == sum);
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
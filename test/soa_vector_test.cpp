@@ -0,0 +1,143 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+struct options
+{
+  cnv::positive<float, throw_on_violation{}> alpha;
+  cnv::bounded<int, 0, 10, throw_on_violation{}> level;
+};
+
+using options_vector =
+    cnv::soa_vector<options, &options::alpha, &options::level>;
+
+struct copy_error
+{};
+
+struct fragile
+{
+  static inline auto throw_on_copy = false;
+
+  int value;
+
+  explicit fragile(int v) noexcept : value{v} {}
+  fragile(const fragile& other) : value{other.value}
+  {
+    if (throw_on_copy) {
+      throw copy_error{};
+    }
+  }
+  fragile(fragile&&) noexcept = default;
+  auto operator=(const fragile&) -> fragile& = default;
+  auto operator=(fragile&&) noexcept -> fragile& = default;
+  ~fragile() = default;
+};
+
+struct tagged
+{
+  cnv::positive<int> id;
+  cnv::constrained_value<fragile, decltype([](const fragile&) { return true; })>
+      payload;
+};
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("stores each member in a separate column") = [] {
+    auto opts = options_vector{};
+    opts.push_back({.alpha = 0.5F, .level = 1});
+    opts.push_back({.alpha = 1.5F, .level = 2});
+
+    expect(2_u == opts.size());
+    expect(0.5_f == opts.column<0>()[0].value());
+    expect(1.5_f == opts.column<0>()[1].value());
+    expect(1_i == opts.column<1>()[0].value());
+    expect(2_i == opts.column<1>()[1].value());
+  };
+
+  test("reconstructs a record from a reference") = [] {
+    auto opts = options_vector{};
+    opts.push_back({.alpha = 0.5F, .level = 1});
+
+    const options record = opts[0];
+
+    expect(0.5_f == record.alpha.value());
+    expect(1_i == record.level.value());
+  };
+
+  test("modifies a member through a reference") = [] {
+    auto opts = options_vector{};
+    opts.push_back({.alpha = 0.5F, .level = 1});
+
+    opts[0].get<1>() = 7;
+
+    expect(7_i == opts.column<1>()[0].value());
+    expect(throws<invalid_value_error>([&opts] { opts[0].get<1>() = 11; }));
+  };
+
+  test("does not modify any column if copying a member throws") = [] {
+    auto records = cnv::soa_vector<tagged, &tagged::id, &tagged::payload>{};
+    records.push_back({.id = 1, .payload = fragile{1}});
+
+    const auto record = tagged{.id = 2, .payload = fragile{2}};
+    fragile::throw_on_copy = true;
+    expect(throws<copy_error>([&] { records.push_back(record); }));
+    fragile::throw_on_copy = false;
+
+    expect(1_u == records.size());
+    expect(1_u == records.column<0>().size());
+    expect(1_u == records.column<1>().size());
+  };
+
+  test("appends validated columns") = [] {
+    const auto alphas = std::vector<float>{0.5F, 1.0F, 2.0F};
+    const auto levels = std::vector<int>{0, 5, 10};
+
+    auto opts = options_vector{};
+    opts.append({alphas, levels});
+
+    expect(3_u == opts.size());
+    expect(std::accumulate(
+               opts.column<1>().begin(), opts.column<1>().end(), 0) == 15_i);
+  };
+
+  test("does not append columns with an invalid value") = [] {
+    auto alphas = std::vector<float>(10'000, 1.0F);
+    auto levels = std::vector<int>(10'000, 3);
+    levels[9'000] = 11;
+
+    auto opts = options_vector{};
+
+    expect(throws<invalid_value_error>(
+        [&] { opts.append({alphas, levels}); }));
+    expect(opts.empty());
+  };
+
+  test("does not append columns of different sizes") = [] {
+    const auto alphas = std::vector<float>{0.5F, 1.0F};
+    const auto levels = std::vector<int>{0};
+
+    auto opts = options_vector{};
+
+    expect(throws<std::invalid_argument>(
+        [&] { opts.append({alphas, levels}); }));
+    expect(opts.empty());
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
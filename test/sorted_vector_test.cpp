@@ -0,0 +1,95 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <functional>
+#include <string>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+template <typename T, typename Compare = std::ranges::less>
+using sorted_or_throw = cnv::sorted_vector<T, Compare, throw_on_violation>;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("checks a range is sorted") = [] {
+    static_assert(cnv::predicate::sorted<>{}(std::array<int, 0>{}));
+    static_assert(cnv::predicate::sorted<>{}(std::array{1, 2, 2, 3}));
+    static_assert(not cnv::predicate::sorted<>{}(std::array{1, 3, 2}));
+    static_assert(
+        cnv::predicate::sorted<std::ranges::greater>{}(std::array{3, 2, 1}));
+  };
+
+  test("checks an invariant") = [] {
+    expect(nothrow([] { sorted_or_throw<int>{std::vector{1, 2, 3}}; }));
+    expect(throws<invalid_value_error>(
+        [] { sorted_or_throw<int>{std::vector{2, 1}}; }));
+  };
+
+  test("converts from a constrained vector") = [] {
+    using sorted_ints = cnv::constrained_value<
+        std::vector<int>,
+        cnv::predicate::sorted<>,
+        throw_on_violation>;
+
+    const auto values = sorted_or_throw<int>{sorted_ints{std::vector{1, 2, 3}}};
+    expect(3_u == values.size());
+  };
+
+  test("finds elements with a binary search") = [] {
+    const auto values = sorted_or_throw<int>{std::vector{1, 3, 3, 5, 7, 9}};
+
+    for (auto x = 0; x != 11; ++x) {
+      const auto expected = std::ranges::lower_bound(values.value(), x);
+      expect(expected == values.lower_bound(x));
+      expect((x % 2 != 0 and x < 10) == values.contains(x));
+    }
+
+    const auto empty = sorted_or_throw<int>{};
+    expect(empty.end() == empty.lower_bound(1));
+    expect(not empty.contains(1));
+  };
+
+  test("inserts elements in order") = [] {
+    auto values = sorted_or_throw<std::string>{};
+
+    values.insert("b");
+    values.insert("d");
+    values.insert("a");
+    const auto it = values.insert("c");
+
+    expect(std::string{"c"} == *it);
+    expect(std::ranges::equal(
+        values, std::vector<std::string>{"a", "b", "c", "d"}));
+  };
+
+  test("merges sorted vectors") = [] {
+    auto values = sorted_or_throw<int>{std::vector{1, 3, 5}};
+    values.merge(sorted_or_throw<int>{std::vector{2, 3, 4}});
+
+    expect(std::ranges::equal(values, std::vector{1, 2, 3, 3, 4, 5}));
+  };
+
+  test("computes the union of sorted vectors") = [] {
+    auto values = sorted_or_throw<int, std::ranges::greater>{
+        std::vector{5, 3, 3, 1}};
+    values.set_union(sorted_or_throw<int, std::ranges::greater>{
+        std::vector{4, 3, 2}});
+
+    expect(std::ranges::equal(values, std::vector{5, 4, 3, 3, 2, 1}));
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,217 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+// Validates UTF-8 one sequence at a time, following Table 3-7 of the Unicode
+// Standard
+auto reference_utf8(std::string_view str) -> bool
+{
+  const auto byte = [str](std::size_t i) {
+    return static_cast<unsigned char>(str[i]);
+  };
+
+  auto i = std::size_t{};
+  while (i != str.size()) {
+    const auto lead = byte(i);
+
+    auto trailing = std::size_t{};
+    auto lo = 0x80;
+    auto hi = 0xBF;
+    if (lead < 0x80) {
+      trailing = 0;
+    } else if (lead >= 0xC2 and lead <= 0xDF) {
+      trailing = 1;
+    } else if (lead >= 0xE0 and lead <= 0xEF) {
+      trailing = 2;
+      lo = (lead == 0xE0) ? 0xA0 : lo;
+      hi = (lead == 0xED) ? 0x9F : hi;
+    } else if (lead >= 0xF0 and lead <= 0xF4) {
+      trailing = 3;
+      lo = (lead == 0xF0) ? 0x90 : lo;
+      hi = (lead == 0xF4) ? 0x8F : hi;
+    } else {
+      return false;
+    }
+
+    if (str.size() - i <= trailing) {
+      return false;
+    }
+    for (auto k = std::size_t{1}; k <= trailing; ++k) {
+      const auto b = byte(i + k);
+      if (b < (k == 1 ? lo : 0x80) or b > (k == 1 ? hi : 0xBF)) {
+        return false;
+      }
+    }
+    i += trailing + 1;
+  }
+  return true;
+}
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("checks ASCII strings") = [] {
+    constexpr auto ascii = cnv::predicate::ascii{};
+
+    static_assert(ascii(""));
+    static_assert(ascii("key"));
+    static_assert(ascii("a string longer than a single word"));
+    static_assert(not ascii("schl\xC3\xBCssel"));
+    static_assert(not ascii("a string longer than a single word\x80"));
+
+    auto str = std::string(1'000, 'a');
+    expect(ascii(str));
+    str[777] = '\xFF';
+    expect(not ascii(str));
+  };
+
+  test("checks well-formed UTF-8 strings") = [] {
+    constexpr auto utf8 = cnv::predicate::utf8{};
+
+    static_assert(utf8(""));
+    static_assert(utf8("schl\xC3\xBCssel"));
+    static_assert(utf8("\xE2\x82\xAC"));
+    static_assert(utf8("\xF0\x9F\x98\x80"));
+    static_assert(utf8("\xF4\x8F\xBF\xBF"));
+    static_assert(utf8("a prefix longer than sixteen characters \xC3\xA9"));
+    static_assert(utf8(
+        "a prefix longer than a block of sixty-four characters, which is "
+        "skipped \xC3\xA9"));
+    static_assert(not utf8(
+        "a prefix longer than a block of sixty-four characters, followed by "
+        "a truncated sequence \xE2\x82"));
+
+    static_assert(not utf8("\x80"));
+    static_assert(not utf8("\xC3"));
+    static_assert(not utf8("\xC3x"));
+    static_assert(not utf8("\xC0\xAF"));
+    static_assert(not utf8("\xE0\x80\xAF"));
+    static_assert(not utf8("\xED\xA0\x80"));
+    static_assert(not utf8("\xF0\x80\x80\xAF"));
+    static_assert(not utf8("\xF4\x90\x80\x80"));
+    static_assert(not utf8("\xF5\x80\x80\x80"));
+    static_assert(not utf8("\xE2\x82"));
+
+    auto str = std::string{};
+    for (auto i = 0; i != 100; ++i) {
+      str += "abcdefghijklmnopqrstuvwxyz \xE2\x82\xAC ";
+    }
+    expect(utf8(str));
+    str[str.size() - 3] = 'x';
+    expect(not utf8(str));
+  };
+
+  test("agrees with a reference validator across blocks") = [] {
+    constexpr auto utf8 = cnv::predicate::utf8{};
+
+    const auto bytes = std::array<char, 16>{
+        '\x00',
+        '\x41',
+        '\x80',
+        '\x8F',
+        '\x90',
+        '\x9F',
+        '\xA0',
+        '\xBF',
+        '\xC0',
+        '\xC2',
+        '\xE0',
+        '\xED',
+        '\xF0',
+        '\xF4',
+        '\xF5',
+        '\xFF'};
+    const auto positions = std::array<std::size_t, 6>{0, 64, 65, 66, 67, 126};
+
+    auto mismatches = 0;
+    for (const auto a : bytes) {
+      for (const auto b : bytes) {
+        for (const auto c : bytes) {
+          for (const auto d : bytes) {
+            for (const auto pos : positions) {
+              auto str = std::string(130, 'x');
+              str[pos] = a;
+              str[pos + 1] = b;
+              str[pos + 2] = c;
+              str[pos + 3] = d;
+
+              mismatches += static_cast<int>(
+                  utf8(str) != reference_utf8(str) or
+                  utf8(std::string_view{str}.substr(0, pos + 3)) !=
+                      reference_utf8(
+                          std::string_view{str}.substr(0, pos + 3)));
+            }
+          }
+        }
+      }
+    }
+    expect(0_i == mismatches);
+  };
+
+  test("checks strings with characters from a set") = [] {
+    constexpr auto hex = cnv::predicate::charset<"0-9a-fA-F">{};
+
+    static_assert(hex(""));
+    static_assert(hex("0123456789abcdefABCDEF"));
+    static_assert(not hex("0x1F"));
+    static_assert(not hex("\xFF"));
+
+    constexpr auto sign_or_digit = cnv::predicate::charset<"-+0-9">{};
+
+    static_assert(sign_or_digit("-12+3"));
+    static_assert(not sign_or_digit("1.5"));
+
+    constexpr auto digit_or_dash = cnv::predicate::charset<"0-9-">{};
+
+    static_assert(digit_or_dash("2024-01-01"));
+    static_assert(not digit_or_dash("2024/01/01"));
+
+    constexpr auto high_bytes = cnv::predicate::charset<"a\x80-\xFF">{};
+
+    static_assert(high_bytes("a\x80\xC3\xBF"));
+    static_assert(not high_bytes("ab"));
+  };
+
+  test("checks the length of a string") = [] {
+    using length = cnv::predicate::length_between<2, 4>;
+
+    static_assert(not length{}(std::string_view{"a"}));
+    static_assert(length{}(std::string_view{"ab"}));
+    static_assert(length{}(std::string_view{"abcd"}));
+    static_assert(not length{}(std::string_view{"abcde"}));
+  };
+
+  test("checks an invariant") = [] {
+    using hex_key = cnv::constrained_value<
+        std::string,
+        cnv::functional::all_of<
+            cnv::predicate::charset<"0-9a-f">,
+            cnv::predicate::length_between<1, 8>>,
+        throw_on_violation>;
+
+    expect(nothrow([] { hex_key{std::string{"c0ffee"}}; }));
+    expect(throws<invalid_value_error>([] { hex_key{std::string{}}; }));
+    expect(throws<invalid_value_error>(
+        [] { hex_key{std::string{"coffee"}}; }));
+    expect(throws<invalid_value_error>(
+        [] { hex_key{std::string{"c0ffee00c0ffee"}}; }));
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,96 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+struct copy_counter
+{
+  static inline auto copies = 0;
+
+  int value;
+
+  explicit copy_counter(int v) noexcept : value{v} {}
+  copy_counter(const copy_counter& other) : value{other.value} { ++copies; }
+  copy_counter(copy_counter&&) noexcept = default;
+  auto operator=(const copy_counter& other) -> copy_counter&
+  {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  auto operator=(copy_counter&&) noexcept -> copy_counter& = default;
+  ~copy_counter() = default;
+};
+
+using positive_or_throw = cnv::constrained_value<
+    int,
+    cnv::predicate::positive,
+    decltype([](auto&&...) { throw invalid_value_error{}; })>;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("returns a value satisfying the invariant") = [] {
+    const auto x = cnv::try_make<cnv::positive<int>>(3);
+
+    expect(x.has_value());
+    expect(3_i == x->value());
+  };
+
+  test("returns a violation without invoking the violation policy") = [] {
+    const auto x = cnv::try_make<positive_or_throw>(-3);
+
+    expect(not x.has_value());
+    expect(-3_i == x.error().value);
+    expect(x.error().predicate_name().find("positive") !=
+           std::string_view::npos);
+  };
+
+  test("is usable in constant expressions") = [] {
+    static_assert(cnv::try_make<cnv::bounded<int, 0, 10>>(5).has_value());
+    static_assert(not cnv::try_make<cnv::bounded<int, 0, 10>>(11).has_value());
+  };
+
+  test("is noexcept for nothrow underlying types") = [] {
+    static_assert(noexcept(cnv::try_make<positive_or_throw>(1)));
+  };
+
+  test("moves the value into the result") = [] {
+    using nonempty = cnv::constrained_value<
+        std::string,
+        decltype([](const std::string& s) { return not s.empty(); })>;
+
+    auto s = std::string(64, 'a');
+    const auto* const data = s.data();
+    const auto x = cnv::try_make<nonempty>(std::move(s));
+
+    expect(x.has_value());
+    expect(data == x->value().data());
+  };
+
+  test("does not copy the value") = [] {
+    using positive_counter = cnv::constrained_value<
+        copy_counter,
+        decltype([](const copy_counter& c) noexcept { return c.value > 0; })>;
+
+    static_assert(noexcept(cnv::try_make<positive_counter>(copy_counter{1})));
+
+    copy_counter::copies = 0;
+    expect(cnv::try_make<positive_counter>(copy_counter{1}).has_value());
+    expect(not cnv::try_make<positive_counter>(copy_counter{0}).has_value());
+    expect(0_i == copy_counter::copies);
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,85 @@
+#include "constrained_value/constrained_value.hpp"
+#include "utility.hpp"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <span>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+auto main() -> int
+{
+  namespace cnv = ::constrained_value;
+  using namespace cnv::test;
+  using namespace ::boost::ut;
+
+  test("projection::norm computes the squared magnitude") = [] {
+    static_assert(cnv::projection::norm{}(-3.0) == 9.0);
+    static_assert(cnv::projection::norm{}(std::array{1.0, 2.0, 2.0}) == 9.0);
+    expect(25.0_d == cnv::projection::norm{}(std::complex{3.0, 4.0}));
+  };
+
+  test("unit_norm constrained_value") = [] {
+    using cnv::constant::ulp;
+
+    constexpr_valid<cnv::unit_norm>(-1.0);
+    constexpr_valid<cnv::unit_norm>(+1.0F);
+    constexpr_valid<cnv::unit_norm>(std::array{0.6, 0.8});
+
+    valid<cnv::unit_norm, ulp<4>>(std::complex{0.6, 0.8});
+    valid<cnv::unit_norm, ulp<4>>(std::polar(1.0, 0.3));
+    valid<cnv::unit_norm, ulp<4>>(
+        std::complex{1.0, 0.0} * std::polar(1.0, 0.7));
+
+    invalid<cnv::unit_norm>(0.0);
+    invalid<cnv::unit_norm>(std::complex<double>{});
+    invalid<cnv::unit_norm>(std::complex{1.0, 1e-6});
+    invalid<cnv::unit_norm>(std::numeric_limits<double>::quiet_NaN());
+    invalid<cnv::unit_norm>(std::array{0.0, 0.0, 1.0 + 1e-9});
+  };
+
+  test("unit_norm tolerance") = [] {
+    using cnv::constant::ulp;
+
+    constexpr auto eps = std::numeric_limits<double>::epsilon();
+
+    // the squared magnitude of 1 + n * eps is approximately 1 + 2 * n * eps
+    static_assert(cnv::predicate::unit_norm<ulp<4>>{}(1.0 + 2 * eps));
+    static_assert(not cnv::predicate::unit_norm<ulp<4>>{}(1.0 + 3 * eps));
+    static_assert(not cnv::predicate::unit_norm<ulp<0>>{}(1.0 + eps));
+    static_assert(cnv::predicate::unit_norm<ulp<0>>{}(1.0));
+  };
+
+  test("renormalize complex values") = [] {
+    auto values = std::vector<std::complex<double>>{
+        {0.6, 0.8}, {3.0, 4.0}, {1.0, 1e-6}, std::polar(1.0, 2.0)};
+
+    expect(2_u == cnv::renormalize(std::span{values}));
+
+    for (const auto& z : values) {
+      expect(cnv::predicate::unit_norm<>{}(z));
+    }
+    expect(0.6_d == values[0].real());
+    expect(std::abs(values[1].real() - 0.6) < 1e-15);
+  };
+
+  test("renormalize fixed-size vectors") = [] {
+    auto values = std::vector<std::array<double, 3>>(100);
+    for (auto i = 0U; i != values.size(); ++i) {
+      values[i] = {1.0, 0.5 * i, 0.25 * i * i};
+    }
+
+    expect(99_u == cnv::renormalize(std::span{values}));
+
+    for (const auto& v : values) {
+      expect(cnv::predicate::unit_norm<>{}(v));
+    }
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,170 @@
+#include "constrained_value/constrained_value.hpp"
+
+#include <boost/ut.hpp>
+
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace cnv = ::constrained_value;
+
+struct invalid_value_error
+{};
+
+using throw_on_violation =
+    decltype([](auto&&...) { throw invalid_value_error{}; });
+
+template <typename T>
+using positive_or_throw = cnv::positive<T, throw_on_violation{}>;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+auto predicate_calls = 0;
+auto violation_line = std::uint_least32_t{};
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+struct counted_positive
+{
+  auto operator()(int x) const -> bool
+  {
+    ++predicate_calls;
+    return x > 0;
+  }
+};
+
+struct record_violation
+{
+  auto operator()(
+      const auto&, const auto&, const char*, const cnv::source_location& sl)
+      const -> void
+  {
+    violation_line = sl.line();
+  }
+};
+
+using counted =
+    cnv::constrained_value<int, counted_positive, record_violation>;
+
+auto main() -> int
+{
+  using namespace ::boost::ut;
+
+  test("views underlying values as constrained values") = [] {
+    const auto values = std::vector<double>{0.5, 1.0, 2.0};
+    auto view = values | cnv::views::constrain<positive_or_throw<double>>;
+
+    static_assert(std::ranges::forward_range<decltype(view)>);
+    static_assert(std::ranges::view<decltype(view)>);
+    static_assert(std::same_as<
+                  std::ranges::range_value_t<decltype(view)>,
+                  positive_or_throw<double>>);
+
+    expect(3_u == std::ranges::size(view));
+
+    auto sum = 0.0;
+    for (auto x : view) {
+      sum += x.value();
+    }
+    expect(3.5_d == sum);
+  };
+
+  test("composes with standard range adaptors") = [] {
+    const auto values = std::vector<int>{-2, -1, 0, 1, 2, 3};
+
+    auto view = values |
+                std::views::filter([](int x) { return x % 2 != 0; }) |
+                std::views::transform([](int x) { return x * x; }) |
+                cnv::views::constrain<positive_or_throw<int>>() |
+                std::views::transform([](auto x) { return x.value(); });
+
+    expect(std::ranges::equal(view, std::vector{1, 1, 9}));
+  };
+
+  test("checks values from a non-contiguous range") = [] {
+    const auto values = std::list<int>{1, 2, 0, 3};
+    auto view = cnv::views::constrain<positive_or_throw<int>>(values);
+    auto it = view.begin();
+
+    expect(1_i == (*it++).value());
+    expect(2_i == (*it++).value());
+    expect(throws<invalid_value_error>([&it] { static_cast<void>(*it); }));
+    expect(3_i == (*++it).value());
+  };
+
+  test("invokes the policy on the first invalid value") = [] {
+    auto values = std::vector<double>(10'000, 1.0);
+    values[9'000] = -1.0;
+
+    auto count = 0;
+    expect(throws<invalid_value_error>([&] {
+      for (auto x : values | cnv::views::constrain<positive_or_throw<double>>) {
+        static_cast<void>(x);
+        ++count;
+      }
+    }));
+    expect(9'000_i == count);
+  };
+
+  test("checks each value once after an invalid value") = [] {
+    const auto values = std::vector<int>(1'000, 0);
+
+    predicate_calls = 0;
+    for (auto x : cnv::views::constrain<counted>(values)) {
+      static_cast<void>(x);
+    }
+    expect(predicate_calls <= 3 * 1'000);
+  };
+
+  test("evaluates elements of a non-contiguous range once") = [] {
+    auto evaluations = 0;
+    auto view = std::views::iota(1, 101) |
+                std::views::transform([&evaluations](int x) {
+                  ++evaluations;
+                  return x;
+                }) |
+                cnv::views::constrain<positive_or_throw<int>>;
+
+    for (auto x : view) {
+      static_cast<void>(x);
+    }
+    expect(100_i == evaluations);
+  };
+
+  test("reports the source location of the pipeline") = [] {
+    const auto values = std::vector<int>{1, 0};
+
+    const auto line = cnv::source_location::current().line() + 1;
+    for (auto x : values | cnv::views::constrain<counted>) {
+      static_cast<void>(x);
+    }
+    expect(line == violation_line);
+
+    violation_line = 0;
+    const auto call_line = cnv::source_location::current().line() + 1;
+    for (auto x : values | cnv::views::constrain<counted>()) {
+      static_cast<void>(x);
+    }
+    expect(call_line == violation_line);
+  };
+
+  test("skips invalid values") = [] {
+    const auto values = std::vector<double>{1.0, -1.0, 2.0, 0.0, 3.0};
+
+    auto view = values | cnv::views::valid_only<positive_or_throw<double>>;
+
+    static_assert(std::same_as<
+                  std::ranges::range_value_t<decltype(view)>,
+                  positive_or_throw<double>>);
+
+    auto sum = 0.0;
+    for (auto x : view) {
+      sum += x.value();
+    }
+    expect(6.0_d == sum);
+  };
+}
+
+// NOLINTEND(readability-magic-numbers)
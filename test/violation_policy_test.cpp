@@ -2,6 +2,8 @@
 
 #include <boost/ut.hpp>
 
+#include <string_view>
+
 namespace cnv = ::constrained_value;
 
 struct nonpositive_value_error
@@ -12,6 +14,24 @@ using positive_double = cnv::constrained_value<
     cnv::predicate::positive,  //
     decltype([](auto&&...) { throw nonpositive_value_error{}; })>;
 
+using dispatched_int = cnv::constrained_value<
+    int,                       //
+    cnv::predicate::positive,  //
+    cnv::on_violation::dispatch>;
+
+namespace {
+
+auto last_violation = cnv::on_violation::dispatch::context{};
+auto last_value = 0;
+
+auto record_violation(const cnv::on_violation::dispatch::context& ctx) -> void
+{
+  last_violation = ctx;
+  last_value = *static_cast<const int*>(ctx.value);
+}
+
+}  // namespace
+
 auto main() -> int
 {
   using namespace ::boost::ut;
@@ -27,4 +47,30 @@ auto main() -> int
       (void)(positive_double{0.0});
     }));
   };
+
+  test("dispatch invokes the installed handler") = [] {
+    using dispatch = cnv::on_violation::dispatch;
+
+    const auto previous = dispatch::set_handler(&record_violation);
+
+    expect(&dispatch::default_handler == previous);
+    expect(&record_violation == dispatch::handler());
+
+    (void)dispatched_int{-1};
+
+    expect(-1_i == last_value);
+    expect(std::string_view{"int"} == last_violation.type);
+    expect(
+        last_violation.predicate.find("positive") != std::string_view::npos);
+    expect(std::string_view{last_violation.caller}.find("constrained_value") !=
+           std::string_view::npos);
+
+    dispatch::set_handler(nullptr);
+
+    expect(&dispatch::default_handler == dispatch::handler());
+  };
+
+  test("dispatch aborts with the default handler") = [] {
+    expect(aborts([] { (void)dispatched_int{0}; }));
+  };
 }